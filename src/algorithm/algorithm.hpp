@@ -9,6 +9,7 @@
 #include "single_objective.hpp"
 #include "nsga2.hpp"
 #include "nsga3.hpp"
+#include "moead.hpp"
 
 /** Single- and multi-objective algorithms that can be used in the GAs. */
 namespace gapp::algorithm {}
@@ -7,6 +7,7 @@
 #include "replacement_base.hpp"
 #include "../core/population.hpp"
 #include "../utility/small_vector.hpp"
+#include "../utility/serialization.hpp"
 #include <cstddef>
 
 namespace gapp
@@ -26,7 +27,7 @@ namespace gapp::algorithm
     * The algorithms define the way the population is evolved over the generations (i.e. the selection and
     * population replacement methods used). They may be single-, multi-objective, or both.
     *
-    * New algorithms should be derived from this class, and there are 5 virtual methods that should be
+    * New algorithms should be derived from this class, and there are 7 virtual methods that should be
     * implemented by them:
     * 
     *  - initializeImpl        (optional) : Initializes the algorithm at the start of a run.
@@ -34,6 +35,8 @@ namespace gapp::algorithm
     *  - selectImpl                       : Selects a candidate from the population for crossover.
     *  - nextPopulationImpl               : Selects the candidates of the next population from the parent and the child populations.
     *  - optimalSolutionsImpl  (optional) : Selects the optimal solutions of the population.
+    *  - saveStateImpl         (optional) : Saves the internal state of the algorithm for checkpointing.
+    *  - loadStateImpl         (optional) : Restores the internal state of the algorithm from a checkpoint.
     */
     class Algorithm : private selection::Selection, private replacement::Replacement
     {
@@ -41,8 +44,10 @@ namespace gapp::algorithm
         /**
         * Initialize the algorithm if needed.
         * 
-        * This method will be called exactly once at start of the run,
-        * after the initial population has already been created.
+        * This method will be called once at start of the run, after the initial population
+        * has already been created. It is also called again during a run if the population is
+        * modified outside of the algorithm (e.g. by the migrations of an island model), so it
+        * should recompute every part of the state that depends on the population.
         * 
         * Implemented by initializeImpl().
         *
@@ -89,13 +94,17 @@ namespace gapp::algorithm
         * 
         * Implemented by nextPopulationImpl().
         *
+        * The populations are updated in place: after the call, @p parents will contain the
+        * candidates of the next generation, and @p children will contain the candidates that
+        * were not selected, so that their storage can be reused for the children of the
+        * next generation.
+        *
         * @param ga The %GA that uses the algorithm.
-        * @param parents The parent population (current population of the GA).
-        * @param children The child population, created from the parent population.
-        * @returns The candidates of the next generation of the algorithm.
+        * @param parents The parent population (current population of the GA). Replaced by the next population.
+        * @param children The child population, created from the parent population. Replaced by the discarded candidates.
         */
         template<typename T>
-        Population<T> nextPopulation(const GA<T>& ga, Population<T> parents, Population<T> children);
+        void nextPopulation(const GA<T>& ga, Population<T>& parents, Population<T>& children);
 
         /**
         * Find the optimal solutions in the population that was created by nextPopulation().
@@ -111,6 +120,30 @@ namespace gapp::algorithm
         template<typename T>
         Candidates<T> optimalSolutions(const GA<T>& ga, const Population<T>& pop) const;
 
+        /**
+        * Save the internal state of the algorithm that is needed to resume a run from a checkpoint,
+        * but that can't be recreated by initialize() from the population of the %GA.
+        * 
+        * This method will be called at the end of the generations when a checkpoint is written.
+        * 
+        * Implemented by saveStateImpl().
+        *
+        * @param out The serializer the state should be written to.
+        */
+        void saveState(detail::binary_writer& out) const { saveStateImpl(out); }
+
+        /**
+        * Restore the internal state of the algorithm from the data written by saveState().
+        * 
+        * This method will be called when a run is resumed from a checkpoint, after
+        * the call to initialize().
+        * 
+        * Implemented by loadStateImpl().
+        *
+        * @param in The deserializer the state should be read from.
+        */
+        void loadState(detail::binary_reader& in) { loadStateImpl(in); }
+
 
         /** Destructor. */
         ~Algorithm() override                   = default;
@@ -139,6 +172,26 @@ namespace gapp::algorithm
         * @returns The indices of the pareto optimal solutions in the current population.
         */
         virtual small_vector<size_t> optimalSolutionsImpl(const GaInfo& ga, const PopulationView& pop) const;
+
+        /**
+        * The implementation of the saveState() function.
+        * 
+        * Algorithms that have an internal state which depends on the previous generations
+        * should override this method. The default implementation doesn't save anything.
+        *
+        * @param out The serializer the state should be written to.
+        */
+        virtual void saveStateImpl(detail::binary_writer& out) const { (void)out; }
+
+        /**
+        * The implementation of the loadState() function.
+        * 
+        * Must read back exactly the data that was written by saveStateImpl().
+        * The default implementation doesn't read anything.
+        *
+        * @param in The deserializer the state should be read from.
+        */
+        virtual void loadStateImpl(detail::binary_reader& in) { (void)in; }
     };
 
 } // namespace gapp::algorithm
@@ -11,7 +11,9 @@
 #include "../utility/functional.hpp"
 #include "../utility/utility.hpp"
 #include <algorithm>
+#include <vector>
 #include <iterator>
+#include <utility>
 #include <cstddef>
 
 namespace gapp::algorithm
@@ -30,7 +32,7 @@ namespace gapp::algorithm
     }
 
     template<typename T>
-    Population<T> Algorithm::nextPopulation(const GA<T>& ga, Population<T> parents, Population<T> children)
+    void Algorithm::nextPopulation(const GA<T>& ga, Population<T>& parents, Population<T>& children)
     {
         GAPP_ASSERT(ga.population_size() == parents.size());
         GAPP_ASSERT(ga.population_size() <= children.size());
@@ -42,11 +44,20 @@ namespace gapp::algorithm
         GAPP_ASSERT(std::all_of(next_pop.begin(), next_pop.end(), detail::points_into(parents)),
                     "An invalid candidate was returned by nextPopulationImpl().");
 
-        return detail::map(next_pop, [](const CandidateInfo* candidate_info)
+        children.resize(next_pop.size());
+
+        for (size_t i = 0; i < next_pop.size(); i++)
         {
-            const auto* candidate = static_cast<const Candidate<T>*>(candidate_info);
-            return std::move(*const_cast<Candidate<T>*>(candidate)); // NOLINT(*const-cast)
-        });
+            auto& candidate = *const_cast<Candidate<T>*>(static_cast<const Candidate<T>*>(next_pop[i])); // NOLINT(*const-cast)
+            children[i] = std::move(candidate);
+            candidate.fitness.clear();
+        }
+
+        /* Every candidate in the combined population is evaluated, so the ones left without a fitness
+         * vector are exactly the ones that were moved into the next population. The rest are kept
+         * so the storage of their chromosomes can be reused. */
+        std::swap(parents, children);
+        std::erase_if(children, [](const Candidate<T>& sol) { return !sol.is_evaluated(); });
     }
 
     template<typename T>
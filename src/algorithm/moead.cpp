@@ -0,0 +1,303 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#include "moead.hpp"
+#include "../core/ga_info.hpp"
+#include "../core/population.hpp"
+#include "../metrics/pop_stats.hpp"
+#include "../utility/algorithm.hpp"
+#include "../utility/iterators.hpp"
+#include "../utility/thread_pool.hpp"
+#include "../utility/math.hpp"
+#include "../utility/serialization.hpp"
+#include "../utility/rng.hpp"
+#include "../utility/utility.hpp"
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include <span>
+#include <limits>
+#include <utility>
+#include <stdexcept>
+#include <cmath>
+#include <cstddef>
+
+namespace gapp::algorithm
+{
+    /* The probability of selecting the parents from the neighbourhood of a subproblem instead of the entire population. */
+    constexpr double NEIGHBOURHOOD_SELECTION_RATE = 0.9;
+
+    /* The penalty parameter of the PBI scalarization. */
+    constexpr double PBI_PENALTY = 5.0;
+
+    /* The minimum weight used for the components of the weight vectors. */
+    constexpr double MIN_WEIGHT = 1E-6;
+
+
+    namespace dtl
+    {
+        /* Distance of fvec from the ideal point along an objective, normalized using the nadir point. */
+        static inline double normalizedDistance(std::span<const double> fvec, std::span<const double> ideal_point, std::span<const double> nadir_point, size_t i) noexcept
+        {
+            return (ideal_point[i] - fvec[i]) / std::max(ideal_point[i] - nadir_point[i], 1E-8);
+        }
+
+        double tchebycheff(std::span<const double> fvec, std::span<const double> weights, std::span<const double> ideal_point, std::span<const double> nadir_point) noexcept
+        {
+            GAPP_ASSERT(fvec.size() == weights.size());
+
+            double dmax = -math::inf<double>;
+            for (size_t i = 0; i < fvec.size(); i++)
+            {
+                dmax = std::max(dmax, std::max(weights[i], MIN_WEIGHT) * normalizedDistance(fvec, ideal_point, nadir_point, i));
+            }
+            return dmax;
+        }
+
+        double pbi(std::span<const double> fvec, std::span<const double> direction, std::span<const double> ideal_point, std::span<const double> nadir_point) noexcept
+        {
+            GAPP_ASSERT(fvec.size() == direction.size());
+
+            double d1 = 0.0;
+            for (size_t i = 0; i < fvec.size(); i++) d1 += normalizedDistance(fvec, ideal_point, nadir_point, i) * direction[i];
+
+            double d2 = 0.0;
+            for (size_t i = 0; i < fvec.size(); i++)
+            {
+                const double diff = normalizedDistance(fvec, ideal_point, nadir_point, i) - d1 * direction[i];
+                d2 += diff * diff;
+            }
+
+            return d1 + PBI_PENALTY * std::sqrt(d2);
+        }
+
+        std::vector<small_vector<size_t>> findNeighbourhoods(const FitnessMatrix& weights, size_t neighbourhood_size)
+        {
+            const size_t nweights = weights.size();
+            neighbourhood_size = std::min(neighbourhood_size, nweights);
+
+            std::vector<small_vector<size_t>> neighbourhoods(nweights);
+
+            detail::parallel_for(detail::iota_iterator(0_sz), detail::iota_iterator(nweights), [&](size_t idx)
+            {
+                std::vector<double> distances(nweights);
+                for (size_t i = 0; i < nweights; i++)
+                {
+                    distances[i] = math::euclideanDistanceSq(weights[idx], weights[i]);
+                }
+                distances[idx] = -1.0; // a weight vector is always part of its own neighbourhood
+
+                const auto neighbours = detail::partial_argsort(distances.begin(), distances.begin() + neighbourhood_size, distances.end());
+                neighbourhoods[idx].assign(neighbours.begin(), neighbours.begin() + neighbourhood_size);
+            });
+
+            return neighbourhoods;
+        }
+
+    } // namespace dtl
+
+
+    MOEAD::MOEAD(Scalarization scalarization, Positive<size_t> neighbourhood_size, RefLineGenerator gen) :
+        weight_generator_(std::move(gen)), scalarization_(scalarization), neighbourhood_size_(neighbourhood_size)
+    {}
+
+    double MOEAD::scalarize(std::span<const double> fvec, size_t subproblem) const noexcept
+    {
+        GAPP_ASSERT(fvec.size() == ideal_point_.size());
+        GAPP_ASSERT(subproblem < weights_.size());
+
+        if (scalarization_ == Scalarization::Tchebycheff)
+        {
+            return dtl::tchebycheff(fvec, weights_[subproblem], ideal_point_, nadir_point_);
+        }
+
+        /* The directions of the PBI subproblems are the normalized weight vectors. */
+        return dtl::pbi(fvec, directions_[subproblem], ideal_point_, nadir_point_);
+    }
+
+    size_t MOEAD::findClosestSubproblem(std::span<const double> fvec) const
+    {
+        FitnessVector fnorm(fvec.size());
+        for (size_t i = 0; i < fvec.size(); i++)
+        {
+            fnorm[i] = (ideal_point_[i] - fvec[i]) / std::max(ideal_point_[i] - nadir_point_[i], 1E-8);
+        }
+
+        /* The directions are unit vectors, so the closest one has the largest inner product with fnorm. */
+        if (!direction_tree_.empty()) return direction_tree_.findBestMatch(fnorm).idx;
+
+        auto inverse_distance = [&](const auto& line) { return std::inner_product(fnorm.begin(), fnorm.end(), line.begin(), 0.0); };
+
+        return size_t(detail::max_element(directions_.begin(), directions_.end(), inverse_distance) - directions_.begin());
+    }
+
+    void MOEAD::initSubproblems()
+    {
+        const size_t nsubproblems = weights_.size();
+        const size_t nobjectives = weights_.ncols();
+
+        /* The optimum of a Tchebycheff subproblem lies along the inverse of its weight vector. */
+        directions_ = weights_;
+        for (auto direction : directions_)
+        {
+            if (scalarization_ == Scalarization::Tchebycheff)
+            {
+                for (double& w : direction) w = 1.0 / std::max(w, MIN_WEIGHT);
+            }
+            math::normalizeVector(direction);
+        }
+
+        /* Same heuristic as for the reference lines of the NSGA-III algorithm. */
+        const bool use_tree = (nobjectives < 16) && (nsubproblems >= (32_sz << nobjectives));
+        direction_tree_ = use_tree ? detail::ConeTree(directions_) : detail::ConeTree{};
+
+        neighbours_ = dtl::findNeighbourhoods(weights_, neighbourhood_size_);
+
+        inverse_neighbours_.assign(nsubproblems, {});
+        for (size_t subproblem = 0; subproblem < nsubproblems; subproblem++)
+        {
+            for (size_t neighbour : neighbours_[subproblem]) inverse_neighbours_[neighbour].push_back(subproblem);
+        }
+    }
+
+    void MOEAD::initializeImpl(const GaInfo& ga)
+    {
+        GAPP_ASSERT(ga.population_size() != 0);
+        GAPP_ASSERT(ga.num_objectives() > 1, "The number of objectives must be greater than 1 for the MOEA/D algorithm.");
+
+        const FitnessMatrix& fitness_matrix = ga.fitness_matrix();
+
+        weights_ = weight_generator_(ga.num_objectives(), ga.population_size());
+        GAPP_ASSERT(weights_.size() == ga.population_size(), "The weight generator must generate a weight vector for each candidate.");
+
+        initSubproblems();
+
+        ideal_point_ = detail::maxFitness(fitness_matrix.begin(), fitness_matrix.end());
+        nadir_point_ = detail::minFitness(fitness_matrix.begin(), fitness_matrix.end());
+    }
+
+    const CandidateInfo& MOEAD::selectImpl(const GaInfo&, const PopulationView& pop) const
+    {
+        GAPP_ASSERT(pop.size() == weights_.size());
+
+        const size_t subproblem = rng::randomIndex(pop);
+        const bool select_neighbours = rng::randomReal() < NEIGHBOURHOOD_SELECTION_RATE;
+
+        const auto& neighbours = neighbours_[subproblem];
+
+        auto random_candidate = [&]
+        {
+            return select_neighbours ? *rng::randomElement(neighbours.begin(), neighbours.end()) : rng::randomIndex(pop);
+        };
+
+        const size_t idx1 = random_candidate();
+        const size_t idx2 = random_candidate();
+
+        return scalarize(pop[idx1].fitness, subproblem) <= scalarize(pop[idx2].fitness, subproblem) ? pop[idx1] : pop[idx2];
+    }
+
+    CandidatePtrVec MOEAD::nextPopulationImpl(const GaInfo& ga, const PopulationView& pop)
+    {
+        GAPP_ASSERT(ga.num_objectives() > 1);
+
+        const size_t nsubproblems = ga.population_size();
+        const size_t nchildren = pop.size() - nsubproblems;
+
+        GAPP_ASSERT(weights_.size() == nsubproblems);
+
+        /* The first nsubproblems candidates of pop are the current solutions of the subproblems, the rest are the children. */
+        const FitnessMatrix fitness_matrix = detail::toFitnessMatrix(pop);
+
+        detail::elementwise_max(ideal_point_, detail::maxFitness(fitness_matrix.begin(), fitness_matrix.end()), detail::inplace_t{});
+        nadir_point_ = detail::minFitness(fitness_matrix.begin(), fitness_matrix.end());
+
+        /* Assign each child to the subproblem closest to it. */
+        std::vector<size_t> child_subproblems(nchildren);
+        detail::parallel_for(detail::iota_iterator(0_sz), detail::iota_iterator(nchildren), [&](size_t child)
+        {
+            child_subproblems[child] = findClosestSubproblem(fitness_matrix[nsubproblems + child]);
+        });
+
+        /* Group the children by their subproblems. */
+        std::vector<size_t> bucket_offsets(nsubproblems + 1, 0);
+        for (size_t subproblem : child_subproblems) bucket_offsets[subproblem + 1]++;
+        std::partial_sum(bucket_offsets.begin(), bucket_offsets.end(), bucket_offsets.begin());
+
+        std::vector<size_t> buckets(nchildren);
+        std::vector<size_t> bucket_sizes(nsubproblems, 0);
+        for (size_t child = 0; child < nchildren; child++)
+        {
+            const size_t subproblem = child_subproblems[child];
+            buckets[bucket_offsets[subproblem] + bucket_sizes[subproblem]++] = nsubproblems + child;
+        }
+
+        /* Find the best child from the neighbourhood of each subproblem that is better than its current solution. */
+        constexpr size_t NONE = std::numeric_limits<size_t>::max();
+
+        std::vector<size_t> best_children(nsubproblems, NONE);
+        std::vector<double> improvements(nsubproblems, 0.0);
+
+        detail::parallel_for(detail::iota_iterator(0_sz), detail::iota_iterator(nsubproblems), [&](size_t subproblem)
+        {
+            const double current_value = scalarize(fitness_matrix[subproblem], subproblem);
+            double best_value = current_value;
+
+            for (size_t neighbour : inverse_neighbours_[subproblem])
+            {
+                for (size_t i = bucket_offsets[neighbour]; i < bucket_offsets[neighbour + 1]; i++)
+                {
+                    const double value = scalarize(fitness_matrix[buckets[i]], subproblem);
+                    if (value < best_value)
+                    {
+                        best_value = value;
+                        best_children[subproblem] = buckets[i];
+                    }
+                }
+            }
+
+            improvements[subproblem] = current_value - best_value;
+        });
+
+        /* A child can only replace the solution of one subproblem, the one where it is the largest improvement. */
+        std::vector<size_t> replaced_subproblems(pop.size(), NONE);
+        for (size_t subproblem = 0; subproblem < nsubproblems; subproblem++)
+        {
+            const size_t child = best_children[subproblem];
+            if (child == NONE) continue;
+
+            size_t& replaced = replaced_subproblems[child];
+            if (replaced == NONE || improvements[subproblem] > improvements[replaced]) replaced = subproblem;
+        }
+
+        CandidatePtrVec new_pop(nsubproblems);
+        for (size_t subproblem = 0; subproblem < nsubproblems; subproblem++)
+        {
+            const size_t child = best_children[subproblem];
+            const bool is_replaced = (child != NONE) && (replaced_subproblems[child] == subproblem);
+
+            new_pop[subproblem] = &pop[is_replaced ? child : subproblem];
+        }
+
+        return new_pop;
+    }
+
+    void MOEAD::saveStateImpl(detail::binary_writer& out) const
+    {
+        out.write_array(std::span<const double>(ideal_point_.data(), ideal_point_.size()));
+        out.write_array(std::span<const double>(nadir_point_.data(), nadir_point_.size()));
+    }
+
+    void MOEAD::loadStateImpl(detail::binary_reader& in)
+    {
+        const auto ideal_point = in.read_array<double>();
+        const auto nadir_point = in.read_array<double>();
+
+        if (ideal_point.size() != weights_.ncols() || nadir_point.size() != weights_.ncols())
+        {
+            GAPP_THROW(std::runtime_error, "Invalid MOEA/D algorithm state.");
+        }
+
+        ideal_point_ = FitnessVector(ideal_point.begin(), ideal_point.end());
+        nadir_point_ = FitnessVector(nadir_point.begin(), nadir_point.end());
+    }
+
+} // namespace gapp::algorithm
@@ -0,0 +1,132 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#ifndef GAPP_ALGORITHM_MOEAD_HPP
+#define GAPP_ALGORITHM_MOEAD_HPP
+
+#include "algorithm_base.hpp"
+#include "reference_lines.hpp"
+#include "../utility/cone_tree.hpp"
+#include "../utility/bounded_value.hpp"
+#include "../utility/small_vector.hpp"
+#include <functional>
+#include <vector>
+#include <span>
+#include <cstddef>
+
+namespace gapp::algorithm
+{
+    /**
+    * MOEA/D algorithm, used for multi- and many-objective optimization.
+    * This algorithm doesn't work for single-objective problems.
+    *
+    * The algorithm decomposes the multi-objective problem into a set of single-objective
+    * subproblems, each of them defined by a weight vector and a scalarization function.
+    * Every candidate of the population is the current solution of one of these subproblems,
+    * and the candidates are only compared to the solutions of the neighbouring subproblems
+    * (the subproblems with the closest weight vectors). As the algorithm doesn't use
+    * non-dominated sorting, it is much cheaper than the NSGA-III algorithm for large
+    * populations and many objectives.
+    *
+    * Each child created in a generation is assigned to the subproblem closest to it in the
+    * objective space, and the solution of each subproblem is replaced by the best child assigned
+    * to its neighbourhood if that child is better than the current solution of the subproblem.
+    * Unlike in the original algorithm, a child can only replace the solution of a single subproblem.
+    *
+    * The candidates are selected for the crossovers using binary tournaments, based on the
+    * scalarized fitness values of a randomly chosen subproblem. The candidates of a tournament
+    * are mostly chosen from the neighbourhood of this subproblem.
+    *
+    * The weight vectors are generated at the start of the run, and don't change throughout it.
+    * The method used for generating the weight vectors can be specified in the constructor.
+    *
+    * The algorithm assumes fitness maximization.
+    *
+    * @see
+    *  Zhang, Q., and Li, H. "MOEA/D: A multiobjective evolutionary algorithm based on decomposition."
+    *  IEEE Transactions on evolutionary computation 11, no. 6 (2007): 712-731.
+    */
+    class MOEAD final : public Algorithm
+    {
+    public:
+        /** The scalarization functions that can be used to define the subproblems. */
+        enum class Scalarization
+        {
+            Tchebycheff,    /**< The weighted Tchebycheff distance from the ideal point. */
+            PBI,            /**< Penalty-based boundary intersection, with a penalty parameter of 5. */
+        };
+
+        /** The type of the weight vector generator function. */
+        using RefLineGenerator = std::function<FitnessMatrix(size_t, size_t)>;
+
+        /**
+        * Create a MOEA/D algorithm.
+        *
+        * @param scalarization The scalarization function used to define the subproblems.
+        * @param neighbourhood_size The number of subproblems in the neighbourhood of each subproblem (including itself).
+        * @param gen The method to use for generating the weight vectors of the subproblems.
+        */
+        explicit MOEAD(Scalarization scalarization = Scalarization::Tchebycheff,
+                       Positive<size_t> neighbourhood_size = 20,
+                       RefLineGenerator gen = reflines::quasirandomSimplexPointsMirror);
+
+        /** @returns The scalarization function used by the algorithm. */
+        [[nodiscard]]
+        Scalarization scalarization() const noexcept { return scalarization_; }
+
+        /** @returns The number of subproblems in the neighbourhood of each subproblem. */
+        [[nodiscard]]
+        size_t neighbourhood_size() const noexcept { return neighbourhood_size_; }
+
+    private:
+        void initializeImpl(const GaInfo& ga) override;
+        void prepareSelectionsImpl(const GaInfo&, const PopulationView&) override {}
+        const CandidateInfo& selectImpl(const GaInfo& ga, const PopulationView& pop) const override;
+
+        CandidatePtrVec nextPopulationImpl(const GaInfo& ga, const PopulationView& pop) override;
+
+        void saveStateImpl(detail::binary_writer& out) const override;
+        void loadStateImpl(detail::binary_reader& in) override;
+
+        /* Return the scalarized value of a fitness vector for a subproblem (lower is better). */
+        double scalarize(std::span<const double> fvec, size_t subproblem) const noexcept;
+
+        /* Return the index of the subproblem closest to the fitness vector. */
+        size_t findClosestSubproblem(std::span<const double> fvec) const;
+
+        /* Initialize the directions of the subproblems and the neighbourhoods based on the weight vectors. */
+        void initSubproblems();
+
+        RefLineGenerator weight_generator_;
+        FitnessMatrix weights_;
+        FitnessMatrix directions_;      // The directions along which the subproblems' optima are in the normalized objective space
+        detail::ConeTree direction_tree_;
+
+        std::vector<small_vector<size_t>> neighbours_;          // The neighbourhood of each subproblem
+        std::vector<small_vector<size_t>> inverse_neighbours_;  // The subproblems whose neighbourhoods contain each subproblem
+
+        FitnessVector ideal_point_;
+        FitnessVector nadir_point_;
+
+        Scalarization scalarization_;
+        size_t neighbourhood_size_;
+    };
+
+} // namespace gapp::algorithm
+
+namespace gapp::algorithm::dtl
+{
+    /*
+    * Find the neighbourhood of each weight vector, which are the neighbourhood_size closest weight vectors to it
+    * (based on their Euclidean distances), including itself. The weight vector itself is always the first element.
+    */
+    std::vector<small_vector<size_t>> findNeighbourhoods(const FitnessMatrix& weights, size_t neighbourhood_size);
+
+    /* Return the weighted Tchebycheff distance of fvec from the ideal point, normalized using the nadir point (lower is better). */
+    double tchebycheff(std::span<const double> fvec, std::span<const double> weights, std::span<const double> ideal_point, std::span<const double> nadir_point) noexcept;
+
+    /* Return the PBI value of fvec for a subproblem with the given unit direction vector, normalized using the nadir point (lower is better). */
+    double pbi(std::span<const double> fvec, std::span<const double> direction, std::span<const double> ideal_point, std::span<const double> nadir_point) noexcept;
+
+} // namespace gapp::algorithm::dtl
+
+#endif // !GAPP_ALGORITHM_MOEAD_HPP
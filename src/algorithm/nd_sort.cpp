@@ -316,19 +316,19 @@ namespace gapp::algorithm::dtl
 
 
     /* Efficient non-dominated sorting algorithm (ENS).
-     * This implementation uses the linear search based variant of the algorithm (ENS-SS).
+     * Both the sequential search (ENS-SS) and the binary search (ENS-BS) based variants of the algorithm are implemented.
      *
      * See:
      *  Zhang, Xingyi, Ye Tian, Ran Cheng, and Yaochu Jin. "An efficient approach to nondominated sorting for
      *  evolutionary multiobjective optimization." IEEE Transactions on Evolutionary Computation 19, no. 2 (2014): 201-213.
      */
 
-    std::vector<FrontElement> efficientNonDominatedSort(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last)
-    {
-        std::vector<FrontElement> pareto_fronts;
-        pareto_fronts.reserve(std::distance(first, last));
+    using FrontIndices = std::vector<std::vector<size_t>>;
 
-        const auto indices = detail::argsort(first, last, [](const auto& lhs, const auto& rhs) noexcept
+    /* Return the indices of the points in [first, last), sorted in lexicographically descending order. */
+    static small_vector<size_t> lexicographicOrder(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last)
+    {
+        return detail::argsort(first, last, [](const auto& lhs, const auto& rhs) noexcept
         {
             for (size_t i = 0; i < lhs.size(); i++)
             {
@@ -336,31 +336,137 @@ namespace gapp::algorithm::dtl
             }
             return false;
         });
+    }
 
-        for (const size_t idx : indices)
+    /* Convert the fronts stored as separate index lists into a single list of front elements sorted by their ranks. */
+    static std::vector<FrontElement> flattenFronts(const FrontIndices& fronts, size_t popsize)
+    {
+        std::vector<FrontElement> pareto_fronts;
+        pareto_fronts.reserve(popsize);
+
+        for (size_t rank = 0; rank < fronts.size(); rank++)
         {
-            size_t rank = 0;
-            auto front_first = pareto_fronts.begin();
+            for (size_t idx : fronts[rank]) pareto_fronts.emplace_back(idx, rank);
+        }
 
-            while (front_first != pareto_fronts.end())
-            {
-                const auto front_last = std::ranges::find_if(front_first, pareto_fronts.end(), detail::not_equal_to(rank), &FrontElement::rank);    
+        return pareto_fronts;
+    }
 
-                const bool dominated = std::any_of(front_first, front_last, [&](const FrontElement& elem)
-                {
-                    return math::paretoCompareLess(first[idx], first[elem.idx]);
-                });
+    /* The fronts used in ENS. The fitness vectors of the points are also stored contiguously in the fronts for the dominance checks. */
+    struct EnsFront
+    {
+        std::vector<size_t> indices;
+        FitnessMatrix points;
+    };
 
-                if (!dominated) break;
+    /* Returns true if any of the points in the front dominates the point. */
+    static bool frontDominates(const EnsFront& front, std::span<const double> point) noexcept
+    {
+        /* The points added to the front last are the most similar to the new point, so they are checked first. */
+        return math::paretoDominatedByAny(point, std::span(front.points.data(), front.points.size() * front.points.ncols()));
+    }
 
-                front_first = front_last;
-                rank++;
-            }
+    enum class FrontSearch { Sequential, Binary, Adaptive };
+
+    static std::vector<FrontElement> efficientNonDominatedSortImpl(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last,
+                                                                   FrontSearch search, std::span<const size_t> known_ranks = {})
+    {
+        std::vector<EnsFront> fronts;
+        size_t sorted_count = 0;
+
+        for (const size_t idx : lexicographicOrder(first, last))
+        {
+            auto dominates = [&](const EnsFront& front) { return frontDominates(front, first[idx]); };
+
+            /* The point is dominated by each of the first known_rank fronts, so these don't have to be searched. */
+            const size_t known_rank = (idx < known_ranks.size()) ? std::min(known_ranks[idx], fronts.size()) : 0;
+            const auto first_front = fronts.begin() + known_rank;
+
+            /* The sequential search checks every front dominating the point, but the binary search has to scan
+             * more non-dominating fronts completely, so it's only faster when there are many small fronts. */
+            const bool binary_search = (search == FrontSearch::Binary) ||
+                                       (search == FrontSearch::Adaptive && 2 * fronts.size() * fronts.size() > sorted_count);
+
+            /* The fronts dominating the point always form a prefix of the fronts, so the first non-dominating one can be found using a binary search. */
+            auto front = binary_search ? std::partition_point(first_front, fronts.end(), dominates) :
+                                         std::find_if_not(first_front, fronts.end(), dominates);
 
-            pareto_fronts.emplace(front_first, idx, rank);
+            if (front == fronts.end()) front = fronts.emplace(fronts.end());
+
+            front->indices.push_back(idx);
+            front->points.append_row(first[idx]);
+            sorted_count++;
         }
 
-        return pareto_fronts;
+        FrontIndices front_indices(fronts.size());
+        for (size_t rank = 0; rank < fronts.size(); rank++)
+        {
+            front_indices[rank] = std::move(fronts[rank].indices);
+        }
+
+        return flattenFronts(front_indices, sorted_count);
+    }
+
+    std::vector<FrontElement> efficientNonDominatedSort(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last)
+    {
+        return efficientNonDominatedSortImpl(first, last, FrontSearch::Sequential);
+    }
+
+    std::vector<FrontElement> efficientNonDominatedSortBS(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last)
+    {
+        return efficientNonDominatedSortImpl(first, last, FrontSearch::Binary);
+    }
+
+
+    /* Non-dominated sorting algorithm for 2 objectives with O(n log n) time complexity.
+     * 
+     * This is a specialization of the ENS-BS algorithm. When the points are processed in lexicographically
+     * descending order, the last point added to a front has the largest second objective value of the points
+     * in the front, so it's the only point that has to be checked when deciding if a front dominates a new point.
+     * 
+     * See:
+     *  Jensen, Mikkel T. "Reducing the run-time complexity of multiobjective EAs: The NSGA-II and other algorithms."
+     *  IEEE Transactions on Evolutionary Computation 7, no. 5 (2003): 503-515.
+     */
+
+    std::vector<FrontElement> twoObjectiveNonDominatedSort(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last)
+    {
+        GAPP_ASSERT(first->size() == 2, "This algorithm can only be used for 2 objectives.");
+
+        FrontIndices fronts;
+
+        for (const size_t idx : lexicographicOrder(first, last))
+        {
+            auto front = std::partition_point(fronts.begin(), fronts.end(), [&](const auto& current_front) noexcept
+            {
+                return math::paretoCompareLess(first[idx], first[current_front.back()]);
+            });
+
+            if (front == fronts.end()) front = fronts.emplace(fronts.end());
+
+            front->push_back(idx);
+        }
+
+        return flattenFronts(fronts, std::distance(first, last));
+    }
+
+
+    /* Incremental non-dominated sorting.
+     *
+     * The rank of a point can only increase when new points are added to the population, and a point with rank r is
+     * always dominated by some point of each of the first r fronts. This means that the first known_rank fronts
+     * can be skipped when searching for the front of a point whose rank was known before the new points were added.
+     * The ranks of the points that were not added can't change due to removing points from the later fronts,
+     * so these can be reused for all of the points that survive a generation of the NSGA-II and NSGA-III algorithms.
+     */
+
+    std::vector<FrontElement> incrementalNonDominatedSort(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last, std::span<const size_t> known_ranks)
+    {
+        GAPP_ASSERT(known_ranks.size() <= size_t(std::distance(first, last)));
+
+        if (first->size() == 2) return twoObjectiveNonDominatedSort(first, last);
+
+        return efficientNonDominatedSortImpl(first, last, FrontSearch::Adaptive, known_ranks);
     }
 
 
@@ -368,7 +474,11 @@ namespace gapp::algorithm::dtl
     {
         GAPP_ASSERT(std::distance(first, last) > 0);
 
-        return efficientNonDominatedSort(first, last);
+        if (first->size() == 2) return twoObjectiveNonDominatedSort(first, last);
+
+        /* Whether the sequential or the binary search based version of ENS is faster depends on
+         * the number and sizes of the fronts, so the search method is selected while sorting. */
+        return efficientNonDominatedSortImpl(first, last, FrontSearch::Adaptive);
     }
 
     ParetoFronts nonDominatedSort(const FitnessMatrix& fmat)
@@ -376,4 +486,38 @@ namespace gapp::algorithm::dtl
         return nonDominatedSort(fmat.begin(), fmat.end());
     }
 
+
+    ParetoFronts IncrementalNdSort::sort(const FitnessMatrix& fmat)
+    {
+        GAPP_ASSERT(!fmat.empty());
+
+        const size_t survivor_count = survivor_ranks_.size();
+
+        const bool has_survivors = (survivor_count != 0) && (survivor_count <= fmat.nrows()) && (survivor_fitness_.ncols() == fmat.ncols()) &&
+                                   std::equal(survivor_fitness_.begin(), survivor_fitness_.end(), fmat.begin());
+
+        if (!has_survivors) return nonDominatedSort(fmat);
+
+        return incrementalNonDominatedSort(fmat.begin(), fmat.end(), survivor_ranks_);
+    }
+
+    void IncrementalNdSort::update(const FitnessMatrix& fmat, const ParetoFronts& next_pop)
+    {
+        survivor_fitness_.clear();
+        survivor_fitness_.reserve(next_pop.size(), fmat.ncols());
+        survivor_ranks_.clear();
+
+        for (const auto& [idx, rank] : next_pop)
+        {
+            survivor_fitness_.append_row(fmat[idx]);
+            survivor_ranks_.push_back(rank);
+        }
+    }
+
+    void IncrementalNdSort::reset() noexcept
+    {
+        survivor_fitness_.clear();
+        survivor_ranks_.clear();
+    }
+
 } // namespace gapp::algorithm::dtl
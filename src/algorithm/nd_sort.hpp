@@ -6,6 +6,7 @@
 #include "../core/population.hpp"
 #include "../utility/iterators.hpp"
 #include <vector>
+#include <span>
 #include <utility>
 #include <cstddef>
 
@@ -98,10 +99,44 @@ namespace gapp::algorithm::dtl
     std::vector<FrontElement> fastNonDominatedSort(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last);
     std::vector<FrontElement> dominanceDegreeSort(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last);
     std::vector<FrontElement> efficientNonDominatedSort(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last);
+    std::vector<FrontElement> efficientNonDominatedSortBS(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last);
+    std::vector<FrontElement> twoObjectiveNonDominatedSort(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last);
 
     ParetoFronts nonDominatedSort(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last);
     ParetoFronts nonDominatedSort(const FitnessMatrix& fmat);
 
+    /* Sort the points in [first, last) into pareto fronts, reusing the ranks of the first known_ranks.size() points, which were
+     * calculated before the rest of the points were added. These ranks must be correct relative to each other. */
+    std::vector<FrontElement> incrementalNonDominatedSort(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last, std::span<const size_t> known_ranks);
+
+
+    /*
+    * Non-dominated sorting of the combined parent and child populations of the NSGA-II and NSGA-III algorithms,
+    * reusing the pareto ranks of the candidates that survived the previous generation.
+    * 
+    * The survivors of a generation are always made up of the best pareto fronts of the combined population,
+    * so their ranks relative to each other are the same as their ranks in the combined population were.
+    * If the leading rows of the fitness matrix passed to sort() are the fitness vectors of the survivors
+    * recorded by the last call to update(), their ranks are reused, and only the new rows are sorted from scratch.
+    * Otherwise (e.g. after the population was changed outside of the algorithm) every row is sorted from scratch.
+    */
+    class IncrementalNdSort
+    {
+    public:
+        /* Sort the rows of the fitness matrix into pareto fronts. */
+        ParetoFronts sort(const FitnessMatrix& fmat);
+
+        /* Record the survivors of the generation. The elements of next_pop must be in the order of the next population. */
+        void update(const FitnessMatrix& fmat, const ParetoFronts& next_pop);
+
+        /* Forget the survivors, so that the next sort is done from scratch. */
+        void reset() noexcept;
+
+    private:
+        FitnessMatrix survivor_fitness_;
+        std::vector<size_t> survivor_ranks_;
+    };
+
 } // namespace gapp::algorithm::dtl
 
 #endif // !GAPP_ALGORITHM_ND_SORT_HPP
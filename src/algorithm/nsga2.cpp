@@ -6,12 +6,16 @@
 #include "../core/population.hpp"
 #include "../utility/algorithm.hpp"
 #include "../utility/functional.hpp"
+#include "../utility/iterators.hpp"
+#include "../utility/thread_pool.hpp"
 #include "../utility/math.hpp"
+#include "../utility/serialization.hpp"
 #include "../utility/rng.hpp"
 #include "../utility/utility.hpp"
 #include <algorithm>
 #include <iterator>
 #include <vector>
+#include <span>
 #include <utility>
 #include <stdexcept>
 #include <cstddef>
@@ -20,41 +24,125 @@ namespace gapp::algorithm
 {
     using namespace dtl;
 
-    /* Calculate the crowding distances of the solutions in pfronts. */
-    static std::vector<double> crowdingDistances(const FitnessMatrix& fmat, const std::vector<ParetoFrontsRange>& pareto_fronts)
+    /* The indices of the candidates of a front, sorted in ascending order along each of the objectives. */
+    using SortedFront = std::vector<std::vector<size_t>>;
+
+    /* Sort the candidates of a front along an objective. */
+    static std::vector<size_t> sortFront(const FitnessMatrix& fmat, const ParetoFrontsRange& front, size_t obj)
     {
-        GAPP_ASSERT(!fmat.empty());
-        GAPP_ASSERT(std::none_of(pareto_fronts.begin(), pareto_fronts.end(), detail::is_size(0)));
+        std::vector<size_t> order(front.size());
+        std::transform(front.begin(), front.end(), order.begin(), [](const FrontElement& sol) { return sol.idx; });
 
-        std::vector crowding_distances(fmat.size(), 0.0);
+        std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) noexcept
+        {
+            return fmat(lhs, obj) < fmat(rhs, obj); // ascending
+        });
+
+        return order;
+    }
 
-        for (size_t obj = 0; obj < fmat.ncols(); obj++)
+    /*
+    * Sort the candidates of a front along both objectives for 2 objectives. The candidates of the front are
+    * non-dominated, so sorting them in ascending order along the first objective generally also sorts them in
+    * descending order along the second one, and only a single sort is needed. This isn't guaranteed because
+    * of the tolerances used for the dominance comparisons, so the second objective is sorted separately if needed.
+    */
+    static SortedFront sortFront2D(const FitnessMatrix& fmat, const ParetoFrontsRange& front)
+    {
+        std::vector<size_t> order(front.size());
+        std::transform(front.begin(), front.end(), order.begin(), [](const FrontElement& sol) { return sol.idx; });
+
+        std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) noexcept
+        {
+            if (fmat(lhs, 0) != fmat(rhs, 0)) return fmat(lhs, 0) < fmat(rhs, 0); // ascending
+            return fmat(lhs, 1) > fmat(rhs, 1); // descending
+        });
+
+        const bool is_reverse_sorted = std::is_sorted(order.begin(), order.end(), [&](size_t lhs, size_t rhs) noexcept
         {
-            const auto fvec = fmat.column(obj);
+            return fmat(lhs, 1) > fmat(rhs, 1);
+        });
+
+        std::vector<size_t> order2 = is_reverse_sorted ? std::vector<size_t>(order.rbegin(), order.rend()) : sortFront(fmat, front, 1);
 
-            for (const auto& front : pareto_fronts)
+        return { std::move(order), std::move(order2) };
+    }
+
+    /* Sort the candidates of each of the fronts along each of the objectives. */
+    template<size_t NumObjectives>
+    static std::vector<SortedFront> sortFronts(const FitnessMatrix& fmat, const std::vector<ParetoFrontsRange>& pareto_fronts)
+    {
+        GAPP_ASSERT(NumObjectives == 0 || NumObjectives == fmat.ncols());
+
+        const size_t nobj = NumObjectives ? NumObjectives : fmat.ncols();
+
+        std::vector<SortedFront> sorted_fronts(pareto_fronts.size(), SortedFront(nobj));
+
+        if constexpr (NumObjectives == 2)
+        {
+            detail::parallel_for(detail::iota_iterator(0_sz), detail::iota_iterator(pareto_fronts.size()), [&](size_t front_idx)
             {
-                std::sort(front.begin(), front.end(), [&](const FrontElement& lhs, const FrontElement& rhs) noexcept
-                {
-                    return fvec[lhs.idx] < fvec[rhs.idx]; // ascending
-                });
+                sorted_fronts[front_idx] = sortFront2D(fmat, pareto_fronts[front_idx]);
+            });
+        }
+        else
+        {
+            /* Each front is sorted along each objective independently of the others. */
+            detail::parallel_for(detail::iota_iterator(0_sz), detail::iota_iterator(pareto_fronts.size() * nobj), [&](size_t task)
+            {
+                const size_t front_idx = task / nobj;
+                const size_t obj = task % nobj;
+
+                sorted_fronts[front_idx][obj] = sortFront(fmat, pareto_fronts[front_idx], obj);
+            });
+        }
+
+        return sorted_fronts;
+    }
+
+    static std::vector<SortedFront> sortFronts(const FitnessMatrix& fmat, const std::vector<ParetoFrontsRange>& pareto_fronts)
+    {
+        return (fmat.ncols() == 2) ? sortFronts<2>(fmat, pareto_fronts) : sortFronts<0>(fmat, pareto_fronts);
+    }
+
+    /* Calculate the crowding distances of the candidates of the sorted fronts. The distances of the other candidates are left unchanged. */
+    static void crowdingDistances(const FitnessMatrix& fmat, std::span<const SortedFront> sorted_fronts, std::vector<double>& crowding_distances)
+    {
+        GAPP_ASSERT(!fmat.empty());
+        GAPP_ASSERT(crowding_distances.size() == fmat.size());
+
+        /* Every candidate belongs to a single front, so the fronts can be processed independently. The per-objective
+         * contributions of a candidate are summed by the same task. */
+        detail::parallel_for(sorted_fronts.begin(), sorted_fronts.end(), [&](const SortedFront& front)
+        {
+            GAPP_ASSERT(!front.empty() && !front[0].empty());
+
+            for (size_t idx : front[0]) crowding_distances[idx] = 0.0;
 
-                const size_t first = front.front().idx;
-                const size_t last  = front.back().idx;
+            for (size_t obj = 0; obj < front.size(); obj++)
+            {
+                const auto& order = front[obj];
 
-                const double finterval = std::max(fvec[last] - fvec[first], 1E-8);
+                const double finterval = std::max(fmat(order.back(), obj) - fmat(order.front(), obj), 1E-8);
 
-                crowding_distances[first] = math::inf<double>;
-                crowding_distances[last]  = math::inf<double>;
+                crowding_distances[order.front()] = math::inf<double>;
+                crowding_distances[order.back()]  = math::inf<double>;
 
-                for (auto it = front.begin() + 1; it < front.end() - 1; ++it)
+                for (size_t i = 1; i + 1 < order.size(); i++)
                 {
-                    const size_t next = std::next(it)->idx;
-                    const size_t prev = std::prev(it)->idx;
-                    crowding_distances[it->idx] += (fvec[next] - fvec[prev]) / finterval;
+                    crowding_distances[order[i]] += (fmat(order[i + 1], obj) - fmat(order[i - 1], obj)) / finterval;
                 }
             }
-        }
+        });
+    }
+
+    /* Calculate the crowding distances of the solutions in pfronts. */
+    static std::vector<double> crowdingDistances(const FitnessMatrix& fmat, const std::vector<ParetoFrontsRange>& pareto_fronts)
+    {
+        GAPP_ASSERT(std::none_of(pareto_fronts.begin(), pareto_fronts.end(), detail::is_size(0)));
+
+        std::vector crowding_distances(fmat.size(), 0.0);
+        crowdingDistances(fmat, sortFronts(fmat, pareto_fronts), crowding_distances);
 
         return crowding_distances;
     }
@@ -67,6 +155,8 @@ namespace gapp::algorithm
 
         ranks_ = pareto_fronts.ranks();
         dists_ = crowdingDistances(ga.fitness_matrix(), pareto_fronts.fronts());
+
+        nd_sort_.reset();
     }
 
     const CandidateInfo& NSGA2::selectImpl(const GaInfo&, const PopulationView& pop) const
@@ -90,18 +180,50 @@ namespace gapp::algorithm
         const size_t popsize = ga.population_size();
         const FitnessMatrix fitness_matrix = detail::toFitnessMatrix(pop);
 
-        auto pareto_fronts = nonDominatedSort(fitness_matrix);
+        auto pareto_fronts = nd_sort_.sort(fitness_matrix);
         auto partial_front = pareto_fronts.partialFront(popsize);
 
-        if (!partial_front.empty()) { dists_ = crowdingDistances(fitness_matrix, { partial_front }); }
-        std::sort(partial_front.begin(), partial_front.end(), [this](const FrontElement& lhs, const FrontElement& rhs)
+        const size_t partial_front_selected = popsize - (partial_front.begin() - pareto_fronts.begin());
+
+        std::vector<double> crowding_distances(fitness_matrix.size(), 0.0);
+        std::vector<SortedFront> sorted_partial_front;
+
+        if (!partial_front.empty())
         {
-            return dists_[lhs.idx] > dists_[rhs.idx]; // descending
-        });
+            sorted_partial_front = sortFronts(fitness_matrix, { partial_front });
+            crowdingDistances(fitness_matrix, sorted_partial_front, crowding_distances);
+
+            std::sort(partial_front.begin(), partial_front.end(), [&](const FrontElement& lhs, const FrontElement& rhs)
+            {
+                return crowding_distances[lhs.idx] > crowding_distances[rhs.idx]; // descending
+            });
+        }
 
         pareto_fronts.resize(popsize);
-        dists_ = crowdingDistances(fitness_matrix, pareto_fronts.fronts());
-        dists_.resize(popsize);
+        nd_sort_.update(fitness_matrix, pareto_fronts);
+
+        /* The crowding distances of the selected part of the partial front have to be recalculated without the
+         * candidates that weren't selected, but the sorted orders of the partial front can be reused for this. */
+        auto new_fronts = pareto_fronts.fronts();
+        const bool has_partial_front = !partial_front.empty() && partial_front_selected != 0;
+
+        if (has_partial_front) new_fronts.pop_back();
+
+        std::vector<SortedFront> sorted_fronts = sortFronts(fitness_matrix, new_fronts);
+
+        if (has_partial_front)
+        {
+            std::vector<bool> is_selected(fitness_matrix.size(), false);
+            std::for_each(partial_front.begin(), partial_front.begin() + partial_front_selected, [&](const FrontElement& sol) { is_selected[sol.idx] = true; });
+
+            for (auto& order : sorted_partial_front[0])
+            {
+                std::erase_if(order, [&](size_t idx) { return !is_selected[idx]; });
+            }
+            sorted_fronts.push_back(std::move(sorted_partial_front[0]));
+        }
+
+        crowdingDistances(fitness_matrix, sorted_fronts, crowding_distances);
 
         CandidatePtrVec new_pop(popsize);
         for (size_t i = 0; i < popsize; i++)
@@ -110,6 +232,7 @@ namespace gapp::algorithm
 
             new_pop[i] = &pop[idx];
             ranks_[i]  = rank;
+            dists_[i]  = crowding_distances[idx];
         }
 
         return new_pop;
@@ -120,4 +243,24 @@ namespace gapp::algorithm
         return detail::find_indices(ranks_, detail::equal_to(0_sz));
     }
 
+    void NSGA2::saveStateImpl(detail::binary_writer& out) const
+    {
+        out.write_array(ranks_);
+        out.write_array(dists_);
+    }
+
+    void NSGA2::loadStateImpl(detail::binary_reader& in)
+    {
+        const auto ranks = in.read_array<size_t>();
+        const auto dists = in.read_array<double>();
+
+        /* The algorithm was initialized before loading its state, so ranks_ already has the size of the population. */
+        if (ranks.size() != ranks_.size() || dists.size() != ranks_.size()) GAPP_THROW(std::runtime_error, "Invalid NSGA-II algorithm state.");
+
+        ranks_.assign(ranks.begin(), ranks.end());
+        dists_.assign(dists.begin(), dists.end());
+
+        nd_sort_.reset();
+    }
+
 } // namespace gapp::algorithm
@@ -4,6 +4,7 @@
 #define GAPP_ALGORITHM_NSGA2_HPP
 
 #include "algorithm_base.hpp"
+#include "nd_sort.hpp"
 #include "../utility/small_vector.hpp"
 #include <vector>
 #include <cstddef>
@@ -43,8 +44,12 @@ namespace gapp::algorithm
 
         small_vector<size_t> optimalSolutionsImpl(const GaInfo& ga, const PopulationView& pop) const override;
 
+        void saveStateImpl(detail::binary_writer& out) const override;
+        void loadStateImpl(detail::binary_reader& in) override;
+
         std::vector<size_t> ranks_;
         std::vector<double> dists_;
+        dtl::IncrementalNdSort nd_sort_;
     };
 
 } // namespace gapp::algorithm
@@ -7,18 +7,23 @@
 #include "../core/population.hpp"
 #include "../metrics/pop_stats.hpp"
 #include "../utility/algorithm.hpp"
+#include "../utility/cone_tree.hpp"
 #include "../utility/functional.hpp"
 #include "../utility/small_vector.hpp"
 #include "../utility/thread_pool.hpp"
 #include "../utility/math.hpp"
+#include "../utility/serialization.hpp"
 #include "../utility/rng.hpp"
 #include "../utility/utility.hpp"
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <numeric>
 #include <vector>
 #include <span>
 #include <utility>
+#include <stdexcept>
+#include <cstdint>
 #include <cstddef>
 
 namespace gapp::algorithm
@@ -83,9 +88,11 @@ namespace gapp::algorithm
 
         RefLineGenerator ref_generator_;
         FitnessMatrix ref_lines_;
+        detail::ConeTree ref_tree_;
 
         std::vector<CandidateTraits> sol_info_;
         std::vector<size_t> niche_counts_;
+        IncrementalNdSort nd_sort_;
 
         FitnessVector ideal_point_;
         FitnessVector nadir_point_;
@@ -94,6 +101,12 @@ namespace gapp::algorithm
         /* Generate n reference points in dim dimensions. */
         FitnessMatrix generateReferencePoints(size_t dim, size_t num_points) const;
 
+        /* Build the search tree used for finding the closest reference lines, if it's worth using for the current reference lines. */
+        void buildReferenceTree();
+
+        /* Return the index of the reference line closest to the normalized fitness vector fnorm. */
+        size_t findClosestRef(std::span<const double> fnorm) const;
+
         /* Update the ideal point approximation using the new points in fmat, assuming maximization. */
         void updateIdealPoint(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last);
 
@@ -121,11 +134,8 @@ namespace gapp::algorithm
         /* Return the (unique) reference indices that are associated with at least one element in pareto_fronts, sorted based on their niche counts. */
         std::vector<size_t> referenceSetOf(std::span<const FrontElement> pareto_fronts);
 
-        /* Return the closest solution associated with ref_idx in pareto_fronts. */
-        FrontElement& findClosestAssociated(std::span<FrontElement> pareto_fronts, size_t ref_idx) const noexcept;
-
-        /* Increment the niche count of ref, while keeping refs sorted based on niche counts. */
-        void incrementNicheCount(std::vector<size_t>& refs, size_t ref);
+        /* Move the count best candidates of the partial front to the front of it based on the niche counts of their reference lines. */
+        void nichedSelection(std::span<FrontElement> partial_front, size_t count);
 
         /* Create a new population from pareto_fronts. */
         CandidatePtrVec createPopulation(std::span<const FrontElement> pareto_fronts, const PopulationView& pop);
@@ -166,6 +176,28 @@ namespace gapp::algorithm
         return ref_points;
     }
 
+    void NSGA3::Impl::buildReferenceTree()
+    {
+        /* The cone tree can only prune the search effectively if there are many reference lines
+         * compared to the number of dimensions, otherwise a linear search is faster. */
+        const size_t dim = ref_lines_.ncols();
+        const bool use_tree = (dim < 16) && (ref_lines_.nrows() >= (32_sz << dim));
+
+        ref_tree_ = use_tree ? detail::ConeTree(ref_lines_) : detail::ConeTree{};
+    }
+
+    size_t NSGA3::Impl::findClosestRef(std::span<const double> fnorm) const
+    {
+        /* The reference lines are unit vectors, so the closest one has the largest inner product with fnorm. */
+        if (!ref_tree_.empty()) return ref_tree_.findBestMatch(fnorm).idx;
+
+        auto inverse_distance = [&](const auto& line) { return std::inner_product(fnorm.begin(), fnorm.end(), line.begin(), 0.0); };
+
+        auto closest = detail::max_element(ref_lines_.begin(), ref_lines_.end(), inverse_distance);
+
+        return size_t(closest - ref_lines_.begin());
+    }
+
     void NSGA3::Impl::updateIdealPoint(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last)
     {
         GAPP_ASSERT(std::distance(first, last) > 0);
@@ -229,13 +261,10 @@ namespace gapp::algorithm
         detail::parallel_for(pareto_fronts.begin(), pareto_fronts.end(), 200, [&](const FrontElement& sol)
         {
             const FitnessVector fnorm = normalizeFitnessVec(first[sol.idx], ideal_point_, nadir_point_);
+            const size_t ref_idx = findClosestRef(fnorm);
 
-            auto inverse_distance = [&](const auto& line) { return std::inner_product(fnorm.begin(), fnorm.end(), line.begin(), 0.0); };
-
-            auto closest = detail::max_element(ref_lines_.begin(), ref_lines_.end(), inverse_distance);
-
-            sol_info_[sol.idx].ref_idx  = std::distance(ref_lines_.begin(), closest);
-            sol_info_[sol.idx].ref_dist = math::perpendicularDistanceSq(*closest, fnorm);
+            sol_info_[sol.idx].ref_idx  = ref_idx;
+            sol_info_[sol.idx].ref_dist = math::perpendicularDistanceSq(ref_lines_[ref_idx], fnorm);
         });
     }
 
@@ -279,22 +308,82 @@ namespace gapp::algorithm
         return refs;
     }
 
-    FrontElement& NSGA3::Impl::findClosestAssociated(std::span<FrontElement> pareto_fronts, size_t ref) const noexcept
+    void NSGA3::Impl::nichedSelection(std::span<FrontElement> partial_front, size_t count)
     {
-        return *detail::min_element(pareto_fronts.begin(), pareto_fronts.end(), [&](const FrontElement& sol)
+        GAPP_ASSERT(count <= partial_front.size());
+
+        if (count == 0) return;
+
+        /* The candidates of the partial front are grouped by their reference lines. The candidates of each
+         * group are sorted in descending order of their distances, so the closest one is always the last. */
+        const std::vector<size_t> refs = referenceSetOf(partial_front);
+
+        std::vector<size_t> group_of(ref_lines_.size());
+        for (size_t i = 0; i < refs.size(); i++) group_of[refs[i]] = i;
+
+        std::vector<small_vector<size_t>> groups(refs.size());
+        for (size_t pos = 0; pos < partial_front.size(); pos++)
         {
-            return (refIndexOf(sol) == ref) ? refDistOf(sol) : math::inf<double>;
-        });
-    }
+            groups[group_of[refIndexOf(partial_front[pos])]].push_back(pos);
+        }
 
-    void NSGA3::Impl::incrementNicheCount(std::vector<size_t>& refs, size_t ref)
-    {
-        niche_counts_[ref]++;
+        for (auto& group : groups)
+        {
+            std::sort(group.begin(), group.end(), [&](size_t lhs, size_t rhs)
+            {
+                return refDistOf(partial_front[lhs]) > refDistOf(partial_front[rhs]); // descending
+            });
+        }
+
+        /* The reference lines that still have candidates associated with them are bucketed by their niche counts.
+         * The niche counts only ever increase by one, and the selected reference line always has the lowest niche
+         * count, so the lowest non-empty bucket can be found by moving forward from the previous one. */
+        const size_t min_niche_count = niche_counts_[refs.front()];
+
+        std::vector<small_vector<size_t>> buckets(niche_counts_[refs.back()] - min_niche_count + 1);
+        for (size_t ref : refs) buckets[niche_counts_[ref] - min_niche_count].push_back(ref);
+
+        std::vector<size_t> selected;
+        selected.reserve(partial_front.size());
+
+        size_t level = 0;
+
+        while (selected.size() < count)
+        {
+            while (buckets[level].empty()) level++;
+
+            /* Select one of the reference lines with the lowest niche count randomly. */
+            auto& bucket = buckets[level];
+            const auto ref_it = rng::randomElement(bucket.begin(), bucket.end());
+            const size_t selected_ref = *ref_it;
+
+            *ref_it = bucket.back();
+            bucket.pop_back();
+
+            auto& group = groups[group_of[selected_ref]];
+            selected.push_back(group.back());
+            group.pop_back();
+
+            niche_counts_[selected_ref]++;
+
+            /* The reference line can't be selected again if there are no more candidates associated with it. */
+            if (!group.empty())
+            {
+                if (level + 1 == buckets.size()) buckets.emplace_back();
+                buckets[level + 1].push_back(selected_ref);
+            }
+        }
 
-        auto current = std::find(refs.begin(), refs.end(), ref);
-        auto first_eq = std::find_if(std::next(current), refs.end(), [&](size_t idx) { return niche_counts_[idx] >= niche_counts_[ref]; });
+        /* Move the selected candidates to the front of the partial front, in the order they were selected. */
+        std::vector<bool> is_selected(partial_front.size(), false);
+        for (size_t pos : selected) is_selected[pos] = true;
+        for (size_t pos = 0; pos < partial_front.size(); pos++)
+        {
+            if (!is_selected[pos]) selected.push_back(pos);
+        }
 
-        std::iter_swap(current, std::prev(first_eq));
+        const std::vector<FrontElement> old_front(partial_front.begin(), partial_front.end());
+        for (size_t i = 0; i < partial_front.size(); i++) partial_front[i] = old_front[selected[i]];
     }
 
     CandidatePtrVec NSGA3::Impl::createPopulation(std::span<const FrontElement> pareto_fronts, const PopulationView& pop)
@@ -330,6 +419,7 @@ namespace gapp::algorithm
         pimpl_->extreme_points_ = {};
 
         pimpl_->ref_lines_ = pimpl_->generateReferencePoints(ga.num_objectives(), ga.population_size());
+        pimpl_->buildReferenceTree();
         pimpl_->niche_counts_.resize(pimpl_->ref_lines_.size());
 
         ParetoFronts pareto_fronts = nonDominatedSort(fitness_matrix.begin(), fitness_matrix.end());
@@ -339,6 +429,8 @@ namespace gapp::algorithm
 
         pimpl_->associatePopWithRefs(fitness_matrix.begin(), fitness_matrix.end(), pareto_fronts);
         pimpl_->recalcNicheCounts(pareto_fronts);
+
+        pimpl_->nd_sort_.reset();
     }
 
     CandidatePtrVec NSGA3::nextPopulationImpl(const GaInfo& ga, const PopulationView& pop)
@@ -348,7 +440,7 @@ namespace gapp::algorithm
         const size_t popsize = ga.population_size();
         const FitnessMatrix fitness_matrix = detail::toFitnessMatrix(pop);
 
-        auto pareto_fronts = nonDominatedSort(fitness_matrix);
+        auto pareto_fronts = pimpl_->nd_sort_.sort(fitness_matrix);
         auto partial_front = pareto_fronts.partialFront(popsize);
 
         pimpl_->sol_info_.resize(pop.size());
@@ -359,37 +451,11 @@ namespace gapp::algorithm
         /* The niche counts should be calculated excluding the partial front for now. */
         pimpl_->recalcNicheCounts({ pareto_fronts.begin(), partial_front.begin() });
 
-        /* Find the reference lines associated with the partial front. */
-        std::vector<size_t> ref_indices = pimpl_->referenceSetOf(partial_front);
-
         /* Move the best elements to the front of the partial front. */
-        for (size_t i = 0; i < popsize - (partial_front.begin() - pareto_fronts.begin()); i++)
-        {
-            const size_t min_niche_count = pimpl_->niche_counts_[ref_indices.front()];
-            const auto last_minimal_ref = std::find_if(ref_indices.begin(), ref_indices.end(), [&](size_t idx)
-            {
-                return pimpl_->niche_counts_[idx] != min_niche_count;
-            });
-
-            const size_t selected_ref_idx = *rng::randomElement(ref_indices.begin(), last_minimal_ref);
-            pimpl_->incrementNicheCount(ref_indices, selected_ref_idx);
-
-            const size_t associated_sol_count = std::count_if(pareto_fronts.begin(), pareto_fronts.end(), [&](const FrontElement& sol)
-            {
-                return pimpl_->refIndexOf(sol) == selected_ref_idx;
-            });
-
-            FrontElement& closest = pimpl_->findClosestAssociated(partial_front, selected_ref_idx);
-
-            /* Move the selected candidate to the front of the partial front so it can't be selected again. */
-            std::swap(closest, partial_front[i]);
-
-            /* If the selected candidate was the only one in the partial front associated with this reference direction,
-               the reference direction needs to also be removed. */
-            if (associated_sol_count == 1) detail::erase_first_stable(ref_indices, selected_ref_idx);
-        }
+        pimpl_->nichedSelection(partial_front, popsize - (partial_front.begin() - pareto_fronts.begin()));
 
         pareto_fronts.resize(popsize);
+        pimpl_->nd_sort_.update(fitness_matrix, pareto_fronts);
 
         return pimpl_->createPopulation(pareto_fronts, pop);
     }
@@ -411,4 +477,73 @@ namespace gapp::algorithm
         return detail::find_indices(pimpl_->sol_info_, [](const auto& sol) { return sol.rank == 0; });
     }
 
+    static void writeFitnessMatrix(detail::binary_writer& out, const FitnessMatrix& fmat)
+    {
+        out.write<std::uint64_t>(fmat.nrows());
+        out.write<std::uint64_t>(fmat.ncols());
+        for (const auto& row : fmat)
+        {
+            for (double f : row) out.write(f);
+        }
+    }
+
+    static FitnessMatrix readFitnessMatrix(detail::binary_reader& in)
+    {
+        const auto nrows = in.read<std::uint64_t>();
+        const auto ncols = in.read<std::uint64_t>();
+
+        if (ncols != 0 && nrows > in.remaining() / (ncols * sizeof(double))) GAPP_THROW(std::runtime_error, "Invalid NSGA-III algorithm state.");
+
+        FitnessMatrix fmat(nrows, ncols);
+        for (size_t row = 0; row < nrows; row++)
+        {
+            for (size_t col = 0; col < ncols; col++) fmat(row, col) = in.read<double>();
+        }
+
+        return fmat;
+    }
+
+    void NSGA3::saveStateImpl(detail::binary_writer& out) const
+    {
+        writeFitnessMatrix(out, pimpl_->ref_lines_);
+        writeFitnessMatrix(out, pimpl_->extreme_points_);
+
+        out.write_array(pimpl_->sol_info_);
+        out.write_array(pimpl_->niche_counts_);
+        out.write_array(std::span<const double>(pimpl_->ideal_point_.data(), pimpl_->ideal_point_.size()));
+        out.write_array(std::span<const double>(pimpl_->nadir_point_.data(), pimpl_->nadir_point_.size()));
+    }
+
+    void NSGA3::loadStateImpl(detail::binary_reader& in)
+    {
+        FitnessMatrix ref_lines = readFitnessMatrix(in);
+        FitnessMatrix extreme_points = readFitnessMatrix(in);
+
+        const auto sol_info = in.read_array<Impl::CandidateTraits>();
+        const auto niche_counts = in.read_array<size_t>();
+        const auto ideal_point = in.read_array<double>();
+        const auto nadir_point = in.read_array<double>();
+
+        /* The algorithm was initialized before loading its state, so the sizes set by the initialization are the expected ones. */
+        const size_t popsize = pimpl_->sol_info_.size();
+        const size_t num_obj = pimpl_->ideal_point_.size();
+
+        const bool valid_state =
+            ref_lines.ncols() == num_obj && niche_counts.size() == ref_lines.nrows() &&
+            (extreme_points.empty() || extreme_points.ncols() == num_obj) &&
+            sol_info.size() == popsize && ideal_point.size() == num_obj && nadir_point.size() == num_obj &&
+            std::all_of(sol_info.begin(), sol_info.end(), [&](const Impl::CandidateTraits& info) { return info.ref_idx < ref_lines.nrows(); });
+
+        if (!valid_state) GAPP_THROW(std::runtime_error, "Invalid NSGA-III algorithm state.");
+
+        pimpl_->ref_lines_ = std::move(ref_lines);
+        pimpl_->buildReferenceTree();
+        pimpl_->extreme_points_ = std::move(extreme_points);
+        pimpl_->sol_info_.assign(sol_info.begin(), sol_info.end());
+        pimpl_->niche_counts_.assign(niche_counts.begin(), niche_counts.end());
+        pimpl_->ideal_point_ = FitnessVector(ideal_point.begin(), ideal_point.end());
+        pimpl_->nadir_point_ = FitnessVector(nadir_point.begin(), nadir_point.end());
+        pimpl_->nd_sort_.reset();
+    }
+
 } // namespace gapp::algorithm
@@ -69,6 +69,9 @@ namespace gapp::algorithm
 
         small_vector<size_t> optimalSolutionsImpl(const GaInfo& ga, const PopulationView& pop) const override;
 
+        void saveStateImpl(detail::binary_writer& out) const override;
+        void loadStateImpl(detail::binary_reader& in) override;
+
         struct Impl;
         std::unique_ptr<Impl> pimpl_;
     };
@@ -6,13 +6,25 @@
 #include "../utility/matrix.hpp"
 #include "../utility/qrng.hpp"
 #include "../utility/math.hpp"
+#include "../utility/iterators.hpp"
+#include "../utility/thread_pool.hpp"
+#include "../utility/serialization.hpp"
+#include "../utility/file_io.hpp"
 #include "../utility/utility.hpp"
 #include <algorithm>
 #include <numeric>
 #include <functional>
 #include <iterator>
+#include <map>
+#include <array>
+#include <tuple>
+#include <mutex>
+#include <string>
 #include <utility>
+#include <stdexcept>
+#include <optional>
 #include <cmath>
+#include <cstdint>
 
 namespace gapp::algorithm::reflines
 {
@@ -157,6 +169,9 @@ namespace gapp::algorithm::reflines
     {
         if (dim * num_points == 0) return {};
 
+        /* The number of candidate points processed together by a thread when updating the distances. */
+        constexpr size_t BLOCK_SIZE = 1024;
+
         FitnessMatrix candidate_points = generator(dim, k * num_points);
 
         FitnessMatrix points;
@@ -180,14 +195,190 @@ namespace gapp::algorithm::reflines
             min_distances.pop_back();
 
             /* Calc the distance of each candidate to the closest ref point. */
-            for (size_t i = 0; i < candidate_points.size(); i++)
+            const auto new_point = points.back();
+            const size_t ncandidates = candidate_points.size();
+            const size_t nblocks = (ncandidates + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+            detail::parallel_for(detail::iota_iterator(0_sz), detail::iota_iterator(nblocks), [&](size_t block)
             {
-                double dist = math::euclideanDistanceSq(candidate_points[i], points.back());
-                min_distances[i] = std::min(min_distances[i], dist);
-            }
+                const size_t last = std::min((block + 1) * BLOCK_SIZE, ncandidates);
+
+                for (size_t i = block * BLOCK_SIZE; i < last; i++)
+                {
+                    double dist = math::euclideanDistanceSq(candidate_points[i], new_point);
+                    min_distances[i] = std::min(min_distances[i], dist);
+                }
+            });
         }
 
         return points;
     }
 
+
+    /*
+    * The layout of the cache files: magic, version, byte order marker, entry count, then (name, dim, num_points, nrows, ncols, points)
+    * for each entry. The dim and num_points fields are the arguments the points were generated for, while nrows and ncols are the
+    * actual shape of the points returned by the generator, which don't have to be the same.
+    */
+    constexpr std::array<char, 8> CACHE_FILE_MAGIC = { 'G', 'A', 'P', 'P', 'R', 'E', 'F', 'L' };
+    constexpr std::uint32_t CACHE_FILE_VERSION = 2;
+    constexpr std::uint32_t CACHE_FILE_BYTE_ORDER = 0x01020304;
+
+    class RefPointCache
+    {
+    public:
+        using Key = std::tuple<std::string, size_t, size_t>;
+
+        static RefPointCache& instance()
+        {
+            static RefPointCache cache;
+            return cache;
+        }
+
+        std::optional<FitnessMatrix> find(const Key& key) const
+        {
+            std::scoped_lock _{ lock_ };
+            auto it = entries_.find(key);
+            if (it == entries_.end()) return std::nullopt;
+            return it->second;
+        }
+
+        /* Existing entries are not replaced. */
+        void insert(Key key, FitnessMatrix points)
+        {
+            std::scoped_lock _{ lock_ };
+            entries_.try_emplace(std::move(key), std::move(points));
+        }
+
+        void clear() noexcept
+        {
+            std::scoped_lock _{ lock_ };
+            entries_.clear();
+        }
+
+        template<typename F>
+        void for_each(F&& f) const
+        {
+            std::scoped_lock _{ lock_ };
+            for (const auto& [key, points] : entries_) std::invoke(f, key, points);
+        }
+
+    private:
+        RefPointCache() = default;
+
+        std::map<Key, FitnessMatrix> entries_;
+        mutable std::mutex lock_;
+    };
+
+
+    std::function<FitnessMatrix(size_t, size_t)> cached(std::string name, std::function<FitnessMatrix(size_t, size_t)> generator)
+    {
+        GAPP_ASSERT(generator, "The generator can't be empty.");
+
+        return [name = std::move(name), generator = std::move(generator)](size_t dim, size_t num_points)
+        {
+            RefPointCache& cache = RefPointCache::instance();
+            RefPointCache::Key key{ name, dim, num_points };
+
+            if (auto points = cache.find(key)) return std::move(*points);
+
+            /* The points are generated without holding the lock, so concurrent calls might generate the same points more than once. */
+            FitnessMatrix points = generator(dim, num_points);
+            cache.insert(std::move(key), points);
+
+            return points;
+        };
+    }
+
+    void saveCache(const std::filesystem::path& path)
+    {
+        const RefPointCache& cache = RefPointCache::instance();
+
+        detail::binary_writer out;
+
+        out.write(CACHE_FILE_MAGIC);
+        out.write(CACHE_FILE_VERSION);
+        out.write(CACHE_FILE_BYTE_ORDER);
+
+        std::uint64_t count = 0;
+        std::vector<std::byte> entries;
+        {
+            detail::binary_writer entry_out;
+            cache.for_each([&](const RefPointCache::Key& key, const FitnessMatrix& points)
+            {
+                entry_out.write_string(std::get<0>(key));
+                entry_out.write<std::uint64_t>(std::get<1>(key));
+                entry_out.write<std::uint64_t>(std::get<2>(key));
+                entry_out.write<std::uint64_t>(points.nrows());
+                entry_out.write<std::uint64_t>(points.ncols());
+                entry_out.write_array(std::span<const double>(points.data(), points.nrows() * points.ncols()));
+                count++;
+            });
+            entries = entry_out.release();
+        }
+
+        out.write<std::uint64_t>(count);
+        out.write_array(std::span<const std::byte>(entries));
+
+        /* The file is replaced atomically, so an existing cache file is never left partially written. */
+        detail::write_file(path, out.release());
+    }
+
+    void loadCache(const std::filesystem::path& path)
+    {
+        const detail::mapped_file file(path);
+        detail::binary_reader in(file.data());
+
+        const auto invalid_file = [&](const char* reason)
+        {
+            GAPP_THROW(std::runtime_error, "Invalid reference point cache file " + path.string() + ": " + reason);
+        };
+
+        if (in.remaining() < CACHE_FILE_MAGIC.size() || in.read<std::remove_const_t<decltype(CACHE_FILE_MAGIC)>>() != CACHE_FILE_MAGIC)
+            invalid_file("not a reference point cache file.");
+        if (in.read<std::uint32_t>() != CACHE_FILE_VERSION)
+            invalid_file("unsupported version.");
+        if (in.read<std::uint32_t>() != CACHE_FILE_BYTE_ORDER)
+            invalid_file("written on a platform with a different byte order.");
+
+        const auto count = in.read<std::uint64_t>();
+        const auto entries = in.read_array<std::byte>();
+
+        /* The entries are read before adding any of them to the cache, so an invalid file doesn't leave the cache partially updated. */
+        std::vector<std::pair<RefPointCache::Key, FitnessMatrix>> loaded;
+        detail::binary_reader entry_in(entries);
+
+        for (std::uint64_t i = 0; i < count; i++)
+        {
+            std::string name(entry_in.read_string());
+            const auto dim = entry_in.read<std::uint64_t>();
+            const auto num_points = entry_in.read<std::uint64_t>();
+            const auto nrows = entry_in.read<std::uint64_t>();
+            const auto ncols = entry_in.read<std::uint64_t>();
+            const auto values = entry_in.read_array<double>();
+
+            /*
+            * The size of the point set is checked without computing nrows * ncols, which could overflow. An empty
+            * point set is always written with 0 rows, since the matrix can't store the number of rows without any values.
+            */
+            const bool valid_shape = (ncols == 0) ? (nrows == 0 && values.empty()) : (nrows <= values.size() / ncols && nrows * ncols == values.size());
+            if (!valid_shape) invalid_file("invalid point set.");
+
+            FitnessMatrix points(nrows, ncols);
+            std::copy(values.begin(), values.end(), points.data());
+
+            loaded.emplace_back(RefPointCache::Key{ std::move(name), dim, num_points }, std::move(points));
+        }
+
+        if (!entry_in.at_end() || !in.at_end()) invalid_file("unexpected data at the end of the file.");
+
+        RefPointCache& cache = RefPointCache::instance();
+        for (auto& [key, points] : loaded) cache.insert(std::move(key), std::move(points));
+    }
+
+    void clearCache() noexcept
+    {
+        RefPointCache::instance().clear();
+    }
+
 } // namespace gapp::algorithm::reflines
\ No newline at end of file
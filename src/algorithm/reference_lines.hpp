@@ -5,6 +5,9 @@
 
 #include "../core/candidate.hpp"
 #include "../utility/bounded_value.hpp"
+#include <functional>
+#include <filesystem>
+#include <string>
 #include <vector>
 #include <cstddef>
 
@@ -66,6 +69,46 @@ namespace gapp::algorithm::reflines
     */
     FitnessMatrix pickSparseSubset(size_t dim, size_t num_points, RefLineGenerator generator, Positive<size_t> k = 10);
 
+
+    /**
+    * Wrap a reference point generator function so that the points generated by it are stored in
+    * a process-wide cache, and are only generated once for each (dim, num_points) pair. This is useful
+    * for expensive generators (e.g. pickSparseSubset) when the algorithms are initialized many times
+    * with the same number of objectives and population size, as the points don't have to be regenerated
+    * for each run. The returned function can be used as the generator of the NSGA3 and MOEAD algorithms.
+    *
+    * The cached points are identified by the name of the generator, the dimension of the points and
+    * the number of points, so the same name should not be used for different generators.
+    *
+    * The cache is thread-safe.
+    *
+    * @param name The unique name used to identify the generator in the cache.
+    * @param generator The simplex point generator function used to generate the points that are not in the cache yet.
+    * @returns A generator function that returns the cached points when possible.
+    */
+    std::function<FitnessMatrix(size_t, size_t)> cached(std::string name, std::function<FitnessMatrix(size_t, size_t)> generator);
+
+    /**
+    * Write every set of points currently in the reference point cache to a binary file, so
+    * that it can be loaded in a later run using loadCache(). The file is replaced if it already exists.
+    * The file is written in the native byte order, and can only be read on platforms using the same byte order.
+    *
+    * @param path The path of the file to write the points to.
+    */
+    void saveCache(const std::filesystem::path& path);
+
+    /**
+    * Load the sets of points written to a file by saveCache() into the reference point cache.
+    * The points that are already in the cache are not replaced by the ones read from the file.
+    * Throws std::runtime_error if the file can't be read, or if it isn't a valid reference point cache file.
+    *
+    * @param path The path of the file to load the points from.
+    */
+    void loadCache(const std::filesystem::path& path);
+
+    /** Remove every set of points from the reference point cache. */
+    void clearCache() noexcept;
+
 } // namespace gapp::algorithm::reflines
 
 #endif // !GAPP_ALGORITHM_REFERENCE_LINES_HPP
@@ -93,6 +93,45 @@ namespace gapp
     using Chromosome = std::vector<T>;
 
 
+    /**
+    * A gene of a chromosome that was changed by a mutation, along with its value before the mutation.
+    * 
+    * @tparam T The gene type.
+    */
+    template<typename T>
+    struct GeneChange
+    {
+        /** The index of the changed gene in the chromosome. */
+        size_t index;
+
+        /** The value of the gene before it was changed. */
+        T old_value;
+    };
+
+    /**
+    * Describes the changes made to a chromosome by a mutation, which can be used to compute
+    * the fitness of the mutated candidate from the fitness it had before the mutation.
+    * The changes are only recorded if the fitness of the candidate was known before the mutation.
+    * 
+    * @tparam T The gene type.
+    */
+    template<typename T>
+    struct GeneChanges
+    {
+        /** The fitness vector of the candidate before the changes. */
+        FitnessVector parent_fitness;
+
+        /** The genes that were changed, in the order of their indices. */
+        std::vector<GeneChange<T>> genes;
+
+        /** @returns True if there are no changes recorded. */
+        bool empty() const noexcept { return genes.empty(); }
+
+        /** Remove the recorded changes, keeping the allocated storage. */
+        void clear() noexcept { parent_fitness.clear(); genes.clear(); }
+    };
+
+
     /**
     * The base class used for the representation of candidate solutions in all of the GAs.
     * This class contains the parts of the candidates that are independent of the encoding type.
@@ -248,6 +287,13 @@ namespace gapp
 
         /** The chromosome encoding the solution. */
         Chromosome<T> chromosome;
+
+        /**
+        * The changes made to the chromosome by the last mutation of the candidate, if they are
+        * known. They are used for the delta evaluation of the candidate, and they are cleared
+        * once the candidate has been evaluated.
+        */
+        GeneChanges<T> changes;
     };
 
     /** A pair of candidates. */
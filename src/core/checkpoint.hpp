@@ -0,0 +1,72 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#ifndef GAPP_CORE_CHECKPOINT_HPP
+#define GAPP_CORE_CHECKPOINT_HPP
+
+#include "candidate.hpp"
+#include "population.hpp"
+#include "../utility/serialization.hpp"
+#include "../utility/utility.hpp"
+#include <array>
+#include <vector>
+#include <span>
+#include <type_traits>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+
+namespace gapp::detail
+{
+    /*
+    * The layout of the checkpoint files (version 1). Every value is stored in the native
+    * byte order, and the arrays are aligned so the file can be used directly after memory mapping it.
+    *
+    *   header         : magic, version, byte order marker, sizeof(T)
+    *   counters       : population_size, max_gen, generation_cntr, num_fitness_evals, num_objectives, num_constraints, chrom_len
+    *   bounds         : array of Bounds<T> (empty for unbounded gene types)
+    *   population     : array of candidates
+    *   solutions      : array of candidates
+    *   fitness cache  : count, then (chromosome, fitness) pairs starting from the oldest entry
+    *   algorithm      : the blob written by Algorithm::saveState()
+    *   rng            : scheduler state, thread count, then the state of each thread's generator
+    */
+    inline constexpr std::array<char, 8> CHECKPOINT_MAGIC = { 'G', 'A', 'P', 'P', 'C', 'K', 'P', 'T' };
+    inline constexpr std::uint32_t CHECKPOINT_VERSION = 1;
+    inline constexpr std::uint32_t CHECKPOINT_BYTE_ORDER = 0x01020304;
+
+    template<typename T>
+    void writeCandidates(binary_writer& out, const std::vector<Candidate<T>>& candidates)
+    {
+        out.write<std::uint64_t>(candidates.size());
+        for (const Candidate<T>& sol : candidates)
+        {
+            out.write_array(sol.chromosome);
+            out.write_array(std::span<const double>(sol.fitness.data(), sol.fitness.size()));
+            out.write_array(std::span<const double>(sol.constraint_violation.data(), sol.constraint_violation.size()));
+        }
+    }
+
+    template<typename T>
+    std::vector<Candidate<T>> readCandidates(binary_reader& in)
+    {
+        const auto count = in.read<std::uint64_t>();
+        if (count > in.remaining()) GAPP_THROW(std::runtime_error, "Invalid number of candidates in the checkpoint.");
+
+        std::vector<Candidate<T>> candidates(count);
+        for (Candidate<T>& sol : candidates)
+        {
+            const auto chromosome = in.read_array<T>();
+            const auto fitness = in.read_array<double>();
+            const auto constraint_violation = in.read_array<double>();
+
+            sol.chromosome.assign(chromosome.begin(), chromosome.end());
+            sol.fitness = FitnessVector(fitness.begin(), fitness.end());
+            sol.constraint_violation = CVVector(constraint_violation.begin(), constraint_violation.end());
+        }
+
+        return candidates;
+    }
+
+} // namespace gapp::detail
+
+#endif // !GAPP_CORE_CHECKPOINT_HPP
@@ -4,9 +4,11 @@
 #define GAPP_CORE_FITNESS_FUNCTION_HPP
 
 #include "candidate.hpp"
+#include "population_matrix.hpp"
 #include "../utility/bounded_value.hpp"
 #include "../utility/utility.hpp"
 #include <functional>
+#include <span>
 #include <utility>
 #include <cstddef>
 
@@ -106,9 +108,132 @@ namespace gapp
         */
         FitnessVector operator()(const Candidate<T>& sol) const { return invoke(sol); }
 
+        /**
+        * Compute the fitness values of several solutions at once.
+        * 
+        * @param sols The candidate solutions to evaluate.
+        * @param fitness_matrix The fitness matrix the fitness vectors of the candidates will be written to.
+        *   It must already be of size [ sols.size() x number_of_objectives ]. The i-th row of the matrix
+        *   will be the fitness vector of the i-th candidate in @p sols.
+        * @returns True if the candidates were evaluated, or false if the fitness function doesn't
+        *   support batch evaluation.
+        */
+        bool operator()(std::span<const Candidate<T>*> sols, FitnessMatrix& fitness_matrix) const
+        {
+            GAPP_ASSERT(fitness_matrix.nrows() == sols.size());
+
+            return invoke_batch(sols, fitness_matrix);
+        }
+
+        /**
+        * Compute the fitness values of several solutions at once, with the solutions stored contiguously.
+        * 
+        * @param sols The candidate solutions to evaluate.
+        * @param fitness_matrix The fitness matrix the fitness vectors of the candidates will be written to.
+        *   It must already be of size [ sols.size() x number_of_objectives ]. The i-th row of the matrix
+        *   will be the fitness vector of the i-th candidate in @p sols.
+        * @returns True if the candidates were evaluated, or false if the fitness function doesn't
+        *   support contiguous batch evaluation.
+        */
+        bool operator()(const PopulationMatrix<T>& sols, FitnessMatrix& fitness_matrix) const
+        {
+            GAPP_ASSERT(fitness_matrix.nrows() == sols.size());
+
+            return invoke_batch_contiguous(sols, fitness_matrix);
+        }
+
+        /**
+        * Compute the fitness value of a solution from the fitness value of the solution it was
+        * derived from, and the genes that were changed in it (delta evaluation).
+        * 
+        * @param parent_fitness The fitness vector of the solution before the changes.
+        * @param sol The candidate solution to evaluate, with the changes already applied to its chromosome.
+        * @param changes The genes of the chromosome that were changed, in the order of their indices.
+        * @returns The fitness vector of the candidate, or an empty fitness vector if the fitness
+        *   function doesn't support delta evaluation.
+        */
+        FitnessVector evaluate_delta(const FitnessVector& parent_fitness, const Candidate<T>& sol, std::span<const GeneChange<T>> changes) const
+        {
+            GAPP_ASSERT(!parent_fitness.empty());
+
+            return invoke_delta(parent_fitness, sol, changes);
+        }
+
     private:
         /** The implementation of the fitness function. Should be thread-safe. */
         virtual FitnessVector invoke(const Candidate<T>& sol) const = 0;
+
+        /**
+        * The implementation of the batch evaluation of the fitness function. Implementing this
+        * is optional, and it's only worth doing if evaluating several candidates at once is more
+        * efficient than evaluating them one at a time (e.g. the evaluation can be vectorized over
+        * the candidates, or they can share some expensive setup).
+        * 
+        * When this is implemented, the GA will use it to evaluate all of the candidates of a generation
+        * that need to be evaluated in a single call. Candidates that have already been evaluated or have
+        * their fitness values cached will not be passed to this function.
+        * 
+        * The default implementation doesn't evaluate any of the candidates, and returns false, in which case
+        * the candidates will be evaluated concurrently using invoke() instead.
+        * 
+        * @param sols The candidate solutions to evaluate.
+        * @param fitness_matrix The fitness matrix the fitness vectors of the candidates should be written to.
+        *   The size of the matrix is [ sols.size() x number_of_objectives ].
+        * @returns True if the candidates were evaluated.
+        */
+        virtual bool invoke_batch([[maybe_unused]] std::span<const Candidate<T>*> sols, [[maybe_unused]] FitnessMatrix& fitness_matrix) const
+        {
+            return false;
+        }
+
+        /**
+        * The implementation of the contiguous batch evaluation of the fitness function. This is the
+        * same as invoke_batch(), except that the chromosomes of the candidates are passed to it in a
+        * single contiguous matrix instead of as separate candidates, which makes it easier to vectorize
+        * the evaluation over the candidates. Implementing this is optional.
+        * 
+        * When this is implemented, the GA will use it instead of invoke_batch() to evaluate the candidates
+        * of a generation, as long as variable chromosome lengths are not allowed in the %GA.
+        * 
+        * The default implementation doesn't evaluate any of the candidates, and returns false, in which case
+        * the candidates will be evaluated using invoke_batch() or invoke() instead.
+        * 
+        * This method is also called once at the start of each run with an empty set of candidates to check
+        * whether the contiguous evaluation is supported, so it should return true in this case if it is.
+        * 
+        * @param sols The candidate solutions to evaluate.
+        * @param fitness_matrix The fitness matrix the fitness vectors of the candidates should be written to.
+        *   The size of the matrix is [ sols.size() x number_of_objectives ].
+        * @returns True if the candidates were evaluated.
+        */
+        virtual bool invoke_batch_contiguous([[maybe_unused]] const PopulationMatrix<T>& sols, [[maybe_unused]] FitnessMatrix& fitness_matrix) const
+        {
+            return false;
+        }
+
+        /**
+        * The implementation of the delta evaluation of the fitness function. Implementing this is
+        * optional, and it's only worth doing if the fitness of a solution can be updated from the
+        * changed genes faster than it could be computed from scratch (e.g. the fitness function is
+        * separable). Should be thread-safe.
+        * 
+        * When this is implemented, the GA will use it to evaluate the candidates that were created
+        * by mutating a solution with a known fitness vector, as long as the fitness function is static.
+        * 
+        * The default implementation returns an empty fitness vector, in which case the candidates will
+        * be evaluated using invoke() instead.
+        * 
+        * @param parent_fitness The fitness vector of the solution before the changes.
+        * @param sol The candidate solution to evaluate, with the changes already applied to its chromosome.
+        * @param changes The genes of the chromosome that were changed, in the order of their indices.
+        * @returns The fitness vector of the candidate, or an empty fitness vector if delta evaluation isn't supported.
+        */
+        virtual FitnessVector invoke_delta([[maybe_unused]] const FitnessVector& parent_fitness,
+                                           [[maybe_unused]] const Candidate<T>& sol,
+                                           [[maybe_unused]] std::span<const GeneChange<T>> changes) const
+        {
+            return {};
+        }
     };
 
     /**
@@ -6,19 +6,24 @@
 #include "ga_info.hpp"
 #include "ga_traits.hpp"
 #include "candidate.hpp"
+#include "population_matrix.hpp"
+#include "pareto_archive.hpp"
 #include "fitness_function.hpp"
 #include "../encoding/gene_types.hpp"
 #include "../stop_condition/stop_condition.hpp"
 #include "../utility/bounded_value.hpp"
 #include "../utility/cache.hpp"
 #include "../utility/type_traits.hpp"
+#include "../utility/rng.hpp"
 #include <algorithm>
 #include <vector>
 #include <utility>
 #include <functional>
 #include <type_traits>
 #include <concepts>
+#include <filesystem>
 #include <memory>
+#include <cstdint>
 #include <cstddef>
 
 namespace gapp::crossover
@@ -401,9 +406,10 @@ namespace gapp
         *   These are the optimal solutions of the last generation's population if
         *   keep_all_optimal_solutions() is not set, otherwise it contains every optimal solution
         *   found during the run (the solution set is updated in every generation in this case).
+        *   The solutions are sorted by their chromosomes.
         */
         [[nodiscard]]
-        const Candidates<T>& solutions() const& noexcept { return solutions_; }
+        const Candidates<T>& solutions() const& noexcept { return solutions_.solutions(); }
 
         /**
         * @returns The current population of the algorithm. This is the entire population,
@@ -621,12 +627,67 @@ namespace gapp
         requires (is_bounded<T> && std::derived_from<F, FitnessFunctionBase<T>>)
         Candidates<T> solve(F fitness_function, Bounds<T> bounds, size_t generations, Population<T> initial_population = {});
 
+
+        /************************** RESUMING RUNS FROM CHECKPOINTS **************************/
+
+        /**
+        * Resume a run of the genetic algorithm from a checkpoint file written during an
+        * earlier run (see checkpoint()).
+        * 
+        * The state of the %GA is restored from the checkpoint, including the population size,
+        * bounds, and max_gen() value of the original run, and the run continues from the generation
+        * after the one the checkpoint was written in. The rest of the settings of the %GA (e.g. the
+        * algorithm and genetic operators used) should be the same as they were in the original run.
+        * 
+        * In the per-thread random number mode (see rng::Mode), the run must be resumed using the same number of
+        * threads as the original run. The counter-based mode allows resuming the run with any number of threads.
+        * 
+        * The file is memory mapped while the state is restored from it, so it's safe to write new
+        * checkpoints to the same file during the resumed run.
+        *
+        * @param fitness_function The fitness function used in the original run. Can't be a nullptr.
+        * @param checkpoint The path of the checkpoint file to resume the run from.
+        * @returns The pareto-optimal solutions found (this is not the final population).
+        * @throws std::runtime_error If the file can't be read, or it isn't a valid checkpoint for this %GA.
+        */
+        Candidates<T> solve(std::unique_ptr<FitnessFunctionBase<T>> fitness_function, const std::filesystem::path& checkpoint) requires (std::is_trivially_copyable_v<T>);
+
+        /**
+        * Resume a run of the genetic algorithm from a checkpoint file written during an
+        * earlier run (see checkpoint()).
+        * 
+        * The state of the %GA is restored from the checkpoint, including the population size,
+        * bounds, and max_gen() value of the original run, and the run continues from the generation
+        * after the one the checkpoint was written in. The rest of the settings of the %GA (e.g. the
+        * algorithm and genetic operators used) should be the same as they were in the original run.
+        * 
+        * In the per-thread random number mode (see rng::Mode), the run must be resumed using the same number of
+        * threads as the original run. The counter-based mode allows resuming the run with any number of threads.
+        *
+        * @param fitness_function The fitness function used in the original run.
+        * @param checkpoint The path of the checkpoint file to resume the run from.
+        * @returns The pareto-optimal solutions found (this is not the final population).
+        * @throws std::runtime_error If the file can't be read, or it isn't a valid checkpoint for this %GA.
+        */
+        template<typename F>
+        requires (std::is_trivially_copyable_v<T> && std::derived_from<F, FitnessFunctionBase<T>>)
+        Candidates<T> solve(F fitness_function, const std::filesystem::path& checkpoint);
+
     private:
 
+        template<typename G>
+        friend class IslandModel;
+
         using MaybeBoundsVector = std::conditional_t<is_bounded<T>, BoundsVector<T>, detail::empty_t>;
 
         Population<T> population_;
-        Candidates<T> solutions_;
+        Population<T> children_; // Recycled storage for the children created in each generation
+        PopulationMatrix<T> contiguous_candidates_; // Recycled storage for the contiguous batch evaluation
+        std::vector<const Candidate<T>*> batch_candidates_; // The candidates passed to the batch evaluation
+        std::vector<size_t> batch_indices_;                 // The indices of the batch evaluated candidates in the population
+        std::vector<char> batch_evaluated_;                 // Whether the candidates were evaluated before the batch evaluation
+        FitnessMatrix batch_fitness_matrix_;                // The fitness matrix written by the batch evaluation
+        detail::ParetoArchive<T> solutions_;
 
         detail::fifo_cache<Candidate<T>, FitnessVector> fitness_cache_;
         size_t cached_generations_ = 0;
@@ -639,7 +700,15 @@ namespace gapp
 
         GAPP_NO_UNIQUE_ADDRESS MaybeBoundsVector bounds_;
 
+        /* The operations the counter-based random number streams are used for (see rng::Mode::CounterBased). */
+        enum class RngPurpose : std::uint64_t { Generation, Initialization, Repair, Crossover, Mutation, Evaluation };
+
+        std::uint64_t rng_stream_ = 0; // Identifies the random number streams of the GA, the islands of an island model use different ones
+        std::uint64_t rng_epoch_ = 0;  // The number of populations created before the current one in the run
+
         bool use_default_mutation_rate_ = false;
+        bool use_batch_evaluation_ = true;
+        bool use_contiguous_evaluation_ = true;
 
         /**
         * Initialize the derived genetic algorithm. This method will be called exactly once
@@ -668,20 +737,34 @@ namespace gapp
         Probability defaultMutationRate() const;
 
         void initializeAlgorithm(MaybeBoundsVector bounds, Population<T> initial_population);
+        void restoreAlgorithm(const std::filesystem::path& checkpoint);
         Population<T> generatePopulation(Positive<size_t> pop_size, Population<T> initial_population) const;
         void prepareSelections() const;
         const Candidate<T>& select() const;
         CandidatePair<T> crossover(const Candidate<T>& parent1, const Candidate<T>& parent2) const;
+        void crossover(const Candidate<T>& parent1, const Candidate<T>& parent2, CandidatePair<T>& children) const;
         void mutate(Candidate<T>& sol) const;
         void validate(Candidate<T>& sol) const;
         void repair(Candidate<T>& sol) const;
-        void updatePopulation(Population<T>&& children);
+        void updatePopulation(Population<T>& children);
         bool stopCondition() const;
 
+        bool supportsContiguousEvaluation() const;
+        bool reuseFitness(Candidate<T>& sol) const;
+        bool evaluateDelta(Candidate<T>& sol);
         void evaluate(Candidate<T>& sol);
-        void updateOptimalSolutions(Candidates<T>& optimal_sols, const Population<T>& pop) const;
+        void evaluate(Population<T>& pop);
+        void updateOptimalSolutions(detail::ParetoArchive<T>& optimal_sols, const Population<T>& pop) const;
+
+        /* Use the counter-based random number stream of a candidate (or of the entire population) in the current generation. */
+        rng::StreamScope rngStream(RngPurpose purpose, size_t idx = 0) const noexcept;
 
         void advance();
+        void advanceSteadyState();
+        void evolve();
+
+        bool checkpointDue() const noexcept;
+        void writeCheckpoint();
 
         /* Invariant checking functions. */
         bool hasValidFitness(const Candidate<T>& sol) const noexcept;
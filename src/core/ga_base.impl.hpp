@@ -7,6 +7,7 @@
 #include "ga_traits.hpp"
 #include "population.hpp"
 #include "fitness_function.hpp"
+#include "checkpoint.hpp"
 #include "../algorithm/algorithm_base.hpp"
 #include "../algorithm/single_objective.hpp"
 #include "../algorithm/nsga3.hpp"
@@ -19,14 +20,28 @@
 #include "../utility/functional.hpp"
 #include "../utility/thread_pool.hpp"
 #include "../utility/scope_exit.hpp"
+#include "../utility/serialization.hpp"
+#include "../utility/file_io.hpp"
+#include "../utility/rng.hpp"
+#include "../utility/small_vector.hpp"
 #include "../utility/utility.hpp"
 #include <algorithm>
 #include <functional>
 #include <numeric>
+#include <vector>
+#include <array>
+#include <string>
+#include <string_view>
+#include <filesystem>
 #include <type_traits>
 #include <memory>
 #include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <stdexcept>
 #include <utility>
+#include <cstdint>
 
 namespace gapp
 {
@@ -334,27 +349,40 @@ namespace gapp
         GAPP_ASSERT(algorithm_ && stop_condition_);
         GAPP_ASSERT(crossover_ && mutation_);
 
-        detail::execution_context::global_thread_pool.reset_scheduler();
+        execution_pool().reset_scheduler();
 
         /* Reset state in case solve() has already been called before. */
         generation_cntr_ = 0;
+        rng_epoch_ = 0;
         num_fitness_evals_ = 0;
+        use_batch_evaluation_ = true;
         solutions_.clear();
+        solutions_.max_size(keep_all_optimal_sols_ ? max_optimal_sols_ : 0);
         population_.clear();
 
         fitness_cache_.reset(!fitness_function_->is_dynamic() * cached_generations_ * population_size_);
 
         if constexpr (is_bounded<T>) { bounds_ = std::move(bounds); }
 
+        auto population_rng_stream = rngStream(RngPurpose::Generation);
+
         /* Derived GA. */
         initialize();
 
         /* Create and evaluate the initial population of the algorithm. */
         std::tie(num_objectives_, num_constraints_) = findObjectiveProperties();
+        use_contiguous_evaluation_ = supportsContiguousEvaluation();
         population_ = generatePopulation(population_size_, std::move(initial_population));
-        detail::parallel_for(population_.begin(), population_.end(), [this](Candidate<T>& sol) { validate(sol); repair(sol); evaluate(sol); });
+        detail::parallel_for(population_.begin(), population_.end(), [this](Candidate<T>& sol)
+        {
+            auto rng_stream = rngStream(RngPurpose::Repair, size_t(&sol - population_.data()));
+
+            validate(sol);
+            repair(sol);
+        });
+        evaluate(population_);
         fitness_matrix_ = detail::toFitnessMatrix(population_);
-        if (keep_all_optimal_sols_) solutions_ = detail::findParetoFront(population_);
+        if (keep_all_optimal_sols_) solutions_.insert(detail::findParetoFront(population_));
 
         GAPP_ASSERT(isValidEvaluatedPopulation(population_));
         GAPP_ASSERT(fitnessMatrixIsSynced());
@@ -375,6 +403,113 @@ namespace gapp
         if (on_generation_end_) on_generation_end_(*this);
     }
 
+    template<typename T>
+    void GA<T>::restoreAlgorithm(const std::filesystem::path& checkpoint)
+    {
+        GAPP_ASSERT(fitness_function_);
+        GAPP_ASSERT(algorithm_ && stop_condition_);
+        GAPP_ASSERT(crossover_ && mutation_);
+
+        auto& thread_pool = execution_pool();
+        thread_pool.reset_scheduler();
+
+        const detail::mapped_file file(checkpoint);
+        detail::binary_reader in(file.data());
+
+        const auto invalid_checkpoint = [&](const char* reason)
+        {
+            GAPP_THROW(std::runtime_error, "Invalid checkpoint file " + checkpoint.string() + ": " + reason);
+        };
+
+        if (in.remaining() < detail::CHECKPOINT_MAGIC.size() || in.read<std::remove_const_t<decltype(detail::CHECKPOINT_MAGIC)>>() != detail::CHECKPOINT_MAGIC)
+            invalid_checkpoint("not a checkpoint file.");
+        if (in.read<std::uint32_t>() != detail::CHECKPOINT_VERSION)
+            invalid_checkpoint("unsupported version.");
+        if (in.read<std::uint32_t>() != detail::CHECKPOINT_BYTE_ORDER)
+            invalid_checkpoint("written on a platform with a different byte order.");
+        if (in.read<std::uint64_t>() != sizeof(T))
+            invalid_checkpoint("written by a GA with a different gene type.");
+
+        const auto population_size = in.read<std::uint64_t>();
+        const auto max_gen = in.read<std::uint64_t>();
+
+        if (population_size == 0) invalid_checkpoint("the population size must be at least 1.");
+        if (max_gen == 0) invalid_checkpoint("the number of generations must be at least 1.");
+
+        population_size_ = population_size;
+        max_gen_ = max_gen;
+        generation_cntr_ = in.read<std::uint64_t>();
+        num_fitness_evals_ = in.read<std::uint64_t>();
+        num_objectives_ = in.read<std::uint64_t>();
+        num_constraints_ = in.read<std::uint64_t>();
+        use_batch_evaluation_ = true;
+        use_contiguous_evaluation_ = supportsContiguousEvaluation();
+
+        if (in.read<std::uint64_t>() != fitness_function_->chrom_len())
+            invalid_checkpoint("written for a fitness function with a different chromosome length.");
+
+        [[maybe_unused]] const auto bounds = in.read_array<Bounds<T>>();
+        if constexpr (is_bounded<T>) { bounds_.assign(bounds.begin(), bounds.end()); }
+
+        /* Derived GA. */
+        initialize();
+
+        population_ = detail::readCandidates<T>(in);
+        solutions_.clear();
+        solutions_.max_size(keep_all_optimal_sols_ ? max_optimal_sols_ : 0);
+        solutions_.insert(detail::readCandidates<T>(in));
+
+        if (population_.size() != population_size_ || !isValidEvaluatedPopulation(population_))
+            invalid_checkpoint("the population doesn't match the GA.");
+
+        fitness_matrix_ = detail::toFitnessMatrix(population_);
+
+        fitness_cache_.reset(!fitness_function_->is_dynamic() * cached_generations_ * population_size_);
+        const auto cache_size = in.read<std::uint64_t>();
+        for (size_t i = 0; i < cache_size; i++)
+        {
+            const auto chromosome = in.read_array<T>();
+            const auto fitness = in.read_array<double>();
+
+            if (fitness_cache_.capacity() == 0) continue;
+            fitness_cache_.insert(Candidate<T>(Chromosome<T>(chromosome.begin(), chromosome.end())), FitnessVector(fitness.begin(), fitness.end()));
+        }
+
+        /* The algorithm is initialized the same way as in a new run, and its state is overwritten by the saved one afterwards. */
+        if (use_default_algorithm_) algorithm_ = defaultAlgorithm();
+        algorithm_->initialize(*this);
+
+        detail::binary_reader algorithm_state(in.read_array<std::byte>());
+        algorithm_->loadState(algorithm_state);
+        if (!algorithm_state.at_end()) invalid_checkpoint("the state of the algorithm doesn't match the algorithm used.");
+
+        if (use_default_mutation_rate_) mutation_rate(defaultMutationRate());
+
+        stop_condition_->initialize(*this);
+        metrics_.initialize(*this);
+
+        /* The random number generators are restored last, since the initialization above might have used them. */
+        const auto scheduler_state = in.read<std::uint64_t>();
+        std::vector<std::string_view> rng_states(in.read<std::uint64_t>());
+        for (auto& rng_state : rng_states) { rng_state = in.read_string(); }
+
+        if (!in.at_end()) invalid_checkpoint("unexpected data at the end of the file.");
+
+        /*
+        * The states of the generators can only be restored if the thread count is the same as it was in the original run.
+        * The numbers don't depend on the states of the thread generators in the counter-based mode, so a different thread
+        * count is only an error in the per-thread mode. The states are not saved at all for steady-state runs.
+        */
+        if (!rng_states.empty() && rng_states.size() != thread_pool.thread_count() && rng::mode() == rng::Mode::PerThread)
+            invalid_checkpoint("written by a run using a different number of threads, which can only be resumed in the counter-based random number mode.");
+
+        if (rng_states.size() == thread_pool.thread_count())
+        {
+            thread_pool.execute_on_each_thread([&](size_t thread_idx) { rng::prng.thread_state(rng_states[thread_idx]); });
+            thread_pool.reset_scheduler(scheduler_state);
+        }
+    }
+
     template<typename T>
     Population<T> GA<T>::generatePopulation(Positive<size_t> pop_size, Population<T> initial_population) const
     {
@@ -388,6 +523,8 @@ namespace gapp
 
         while (population.size() < pop_size)
         {
+            auto rng_stream = rngStream(RngPurpose::Initialization, population.size());
+
             population.push_back(generateCandidate());
             GAPP_ASSERT(hasValidChromosome(population.back()), "An invalid solution was returned by generateCandidate().");
         }
@@ -421,6 +558,14 @@ namespace gapp
         return (*crossover_)(*this, parent1, parent2);
     }
 
+    template<typename T>
+    inline void GA<T>::crossover(const Candidate<T>& parent1, const Candidate<T>& parent2, CandidatePair<T>& children) const
+    {
+        GAPP_ASSERT(crossover_);
+
+        (*crossover_)(*this, parent1, parent2, children);
+    }
+
     template<typename T>
     inline void GA<T>::mutate(Candidate<T>& sol) const
     {
@@ -450,6 +595,8 @@ namespace gapp
 
         if (repair_(*this, sol, sol.chromosome))
         {
+            /* The changes made by the mutation don't describe the difference from the parent anymore. */
+            sol.changes.clear();
             sol.fitness.clear();
             validate(sol);
         }
@@ -458,15 +605,21 @@ namespace gapp
     }
 
     template<typename T>
-    void GA<T>::updatePopulation(Population<T>&& children)
+    void GA<T>::updatePopulation(Population<T>& children)
     {
         GAPP_ASSERT(algorithm_);
         GAPP_ASSERT(isValidEvaluatedPopulation(population_));
         GAPP_ASSERT(fitnessMatrixIsSynced());
 
         fitness_cache_.insert(population_.begin(), population_.end(), &Candidate<T>::fitness);
-        population_ = algorithm_->nextPopulation(*this, std::move(population_), std::move(children));
-        fitness_matrix_ = detail::toFitnessMatrix(population_);
+        algorithm_->nextPopulation(*this, population_, children);
+
+        /* The fitness matrix is refilled instead of recreated to reuse its storage. */
+        fitness_matrix_.clear();
+        for (const Candidate<T>& sol : population_)
+        {
+            fitness_matrix_.append_row(sol.fitness);
+        }
     }
 
     template<typename T>
@@ -478,15 +631,14 @@ namespace gapp
     }
 
     template<typename T>
-    inline void GA<T>::evaluate(Candidate<T>& sol)
+    inline bool GA<T>::reuseFitness(Candidate<T>& sol) const
     {
         GAPP_ASSERT(fitness_function_);
-        GAPP_ASSERT(hasValidChromosome(sol));
 
         /* If the fitness function is static, and the solution has already
          * been evaluted sometime earlier (in an earlier generation), there
          * is no point doing it again. */
-        if (!fitness_function_->is_dynamic() && sol.is_evaluated()) return;
+        if (!fitness_function_->is_dynamic() && sol.is_evaluated()) return true;
         
         if (cached_generations_)
         {
@@ -495,10 +647,45 @@ namespace gapp
             if (const FitnessVector* fitness = fitness_cache_.get(sol))
             {
                 sol.fitness = *fitness;
-                return;
+                return true;
             }
         }
 
+        return false;
+    }
+
+    template<typename T>
+    inline bool GA<T>::evaluateDelta(Candidate<T>& sol)
+    {
+        GAPP_ASSERT(fitness_function_);
+
+        if (sol.changes.empty()) return false;
+
+        /* The changes are only needed for this evaluation, so they are always cleared. */
+        detail::scope_exit clear_changes{ [&] { sol.changes.clear(); } };
+
+        /* The fitness vector of the parent is not valid anymore if the fitness function is dynamic. */
+        if (fitness_function_->is_dynamic()) return false;
+
+        FitnessVector fitness = fitness_function_->evaluate_delta(sol.changes.parent_fitness, sol, sol.changes.genes);
+        if (fitness.empty()) return false;
+
+        std::atomic_ref{ num_fitness_evals_ }.fetch_add(1, std::memory_order_release);
+        sol.fitness = std::move(fitness);
+
+        GAPP_ASSERT(hasValidFitness(sol));
+
+        return true;
+    }
+
+    template<typename T>
+    inline void GA<T>::evaluate(Candidate<T>& sol)
+    {
+        GAPP_ASSERT(fitness_function_);
+        GAPP_ASSERT(hasValidChromosome(sol));
+
+        if (evaluateDelta(sol) || reuseFitness(sol)) return;
+
         std::atomic_ref{ num_fitness_evals_ }.fetch_add(1, std::memory_order_release);
         sol.fitness = (*fitness_function_)(sol);
 
@@ -506,23 +693,106 @@ namespace gapp
     }
 
     template<typename T>
-    void GA<T>::updateOptimalSolutions(Candidates<T>& optimal_sols, const Population<T>& pop) const
+    bool GA<T>::supportsContiguousEvaluation() const
     {
-        GAPP_ASSERT(algorithm_);
+        GAPP_ASSERT(fitness_function_);
 
-        auto optimal_pop = algorithm_->optimalSolutions(*this, pop);
+        /* The fitness functions that implement the contiguous batch evaluation return true even if there are no candidates. */
+        FitnessMatrix fitness_matrix(0, num_objectives());
 
-        optimal_sols = detail::mergeParetoSets(std::move(optimal_sols), std::move(optimal_pop));
+        return (*fitness_function_)(PopulationMatrix<T>{}, fitness_matrix);
+    }
 
-        /* Duplicate elements are removed from optimal_sols using exact comparison
-        *  of the chromosomes in order to avoid issues with using a non-transitive
-        *  comparison function for std::sort and std::unique. */
-        auto chrom_eq = [](const auto& lhs, const auto& rhs) { return lhs.chromosome == rhs.chromosome; };
-        auto chrom_less = [](const auto& lhs, const auto& rhs) { return lhs.chromosome < rhs.chromosome; };
+    template<typename T>
+    void GA<T>::evaluate(Population<T>& pop)
+    {
+        GAPP_ASSERT(fitness_function_);
 
-        std::sort(optimal_sols.begin(), optimal_sols.end(), chrom_less);
-        auto last = std::unique(optimal_sols.begin(), optimal_sols.end(), chrom_eq);
-        optimal_sols.erase(last, optimal_sols.end());
+        if (use_batch_evaluation_)
+        {
+            /* The delta evaluations and the fitness cache lookups can be expensive too, so they are done in parallel,
+             * and only the candidates that still need to be evaluated afterwards are passed to the batch evaluation. */
+            batch_evaluated_.assign(pop.size(), false);
+
+            detail::parallel_for(detail::iota_iterator(0_sz), detail::iota_iterator(pop.size()), [&](size_t i)
+            {
+                GAPP_ASSERT(hasValidChromosome(pop[i]));
+
+                auto rng_stream = rngStream(RngPurpose::Evaluation, i);
+
+                batch_evaluated_[i] = evaluateDelta(pop[i]) || reuseFitness(pop[i]);
+            });
+
+            /* The buffers of the batch evaluation are members so their storage is reused between the generations. */
+            batch_indices_.clear();
+            batch_candidates_.clear();
+
+            for (size_t i = 0; i < pop.size(); i++)
+            {
+                if (batch_evaluated_[i]) continue;
+
+                batch_indices_.push_back(i);
+                batch_candidates_.push_back(&pop[i]);
+            }
+
+            if (batch_candidates_.empty()) return;
+
+            batch_fitness_matrix_.resize(batch_candidates_.size(), num_objectives());
+            bool evaluated = false;
+
+            /* The chromosomes can only be stored contiguously if they are all the same length. */
+            if (use_contiguous_evaluation_ && !(crossover_->allow_variable_chrom_length() && mutation_->allow_variable_chrom_length()))
+            {
+                contiguous_candidates_.assign(batch_candidates_);
+                evaluated = (*fitness_function_)(contiguous_candidates_, batch_fitness_matrix_);
+
+                /* Don't try it again in this run if the fitness function doesn't support contiguous evaluation. */
+                use_contiguous_evaluation_ = evaluated;
+            }
+
+            if (evaluated || (*fitness_function_)(batch_candidates_, batch_fitness_matrix_))
+            {
+                num_fitness_evals_ += batch_candidates_.size();
+
+                for (size_t i = 0; i < batch_indices_.size(); i++)
+                {
+                    const auto fvec = batch_fitness_matrix_[i];
+                    pop[batch_indices_[i]].fitness.assign(fvec.begin(), fvec.end());
+                    GAPP_ASSERT(hasValidFitness(pop[batch_indices_[i]]));
+                }
+                return;
+            }
+
+            /* The fitness function doesn't support batch evaluation, don't try it again in this run. */
+            use_batch_evaluation_ = false;
+        }
+
+        /* The cost of the fitness evaluations can vary a lot, so they are distributed dynamically when possible. A fitness
+         * function might use the random number generators, so in the per-thread mode the candidates must always be evaluated
+         * on the same threads to keep the results reproducible. In the counter-based mode, the random numbers only depend on
+         * the candidates, so the threads they are evaluated on don't matter. */
+        const auto schedule = (rng::mode() == rng::Mode::CounterBased) ? detail::schedule_type::guided : detail::schedule_type::static_blocks;
+
+        detail::parallel_for(pop.begin(), pop.end(), schedule, [&](Candidate<T>& sol)
+        {
+            auto rng_stream = rngStream(RngPurpose::Evaluation, size_t(&sol - pop.data()));
+
+            evaluate(sol);
+        });
+    }
+
+    template<typename T>
+    void GA<T>::updateOptimalSolutions(detail::ParetoArchive<T>& optimal_sols, const Population<T>& pop) const
+    {
+        GAPP_ASSERT(algorithm_);
+
+        optimal_sols.insert(algorithm_->optimalSolutions(*this, pop));
+    }
+
+    template<typename T>
+    inline rng::StreamScope GA<T>::rngStream(RngPurpose purpose, size_t idx) const noexcept
+    {
+        return rng::StreamScope{ rng_stream_, rng_epoch_, idx, std::uint64_t(purpose) };
     }
 
     template<typename T>
@@ -530,28 +800,50 @@ namespace gapp
     {
         GAPP_ASSERT(population_.size() == population_size_);
 
-        Population<T> children(population_size_);
+        /* The serial parts of the generation (e.g. the algorithm's population update) use the stream of the population. */
+        rng_epoch_ = generation_cntr_ + 1;
+        auto population_rng_stream = rngStream(RngPurpose::Generation);
+
+        /* The children are written into the candidates that were discarded in the previous generation,
+         * so their chromosomes can reuse the storage of the old ones. */
+        Population<T>& children = children_;
+        children.resize(population_size_);
 
         prepareSelections();
 
         detail::parallel_for(detail::iota_iterator(0_sz), detail::iota_iterator(population_size_ / 2), [&](size_t i)
         {
-            CandidatePair child_pair = crossover(select(), select());
+            auto rng_stream = rngStream(RngPurpose::Crossover, i);
+
+            CandidatePair<T> child_pair{ std::move(children[2 * i]), std::move(children[2 * i + 1]) };
+            crossover(select(), select(), child_pair);
             children[2 * i]     = std::move(child_pair.first);
             children[2 * i + 1] = std::move(child_pair.second);
         });
 
-        if (population_size_ % 2) children.back() = crossover(select(), select()).first;
+        if (population_size_ % 2)
+        {
+            auto rng_stream = rngStream(RngPurpose::Crossover, population_size_ / 2);
 
-        detail::parallel_for(children.begin(), children.end(), [this](Candidate<T>& child)
+            CandidatePair<T> child_pair{ std::move(children.back()) };
+            crossover(select(), select(), child_pair);
+            children.back() = std::move(child_pair.first);
+        }
+
+        /* The genetic operators use the thread-local random number generators, so these must be
+         * scheduled statically in order to keep the results of the runs reproducible. */
+        detail::parallel_for(children.begin(), children.end(), [&](Candidate<T>& child)
         {
+            auto rng_stream = rngStream(RngPurpose::Mutation, size_t(&child - children.data()));
+
             mutate(child);
             validate(child);
             repair(child);
-            evaluate(child);
         });
 
-        updatePopulation(std::move(children));
+        evaluate(children);
+
+        updatePopulation(children);
 
         if (keep_all_optimal_sols_) updateOptimalSolutions(solutions_, population_);
         metrics_.update(*this);
@@ -560,24 +852,218 @@ namespace gapp
         generation_cntr_++;
     }
 
+    template<typename T>
+    void GA<T>::advanceSteadyState()
+    {
+        GAPP_ASSERT(population_.size() == population_size_);
+
+        /*
+        * Every thread breeds and evaluates its own children without waiting for the other threads. The children are bred while
+        * holding a shared lock on the population, and they are evaluated without holding any locks. The finished children are
+        * handed over to a common buffer, and once it contains enough children for a generation, the thread that filled it inserts
+        * them into the population while holding an exclusive lock.
+        */
+        detail::thread_pool& thread_pool = detail::execution_context::current();
+
+        std::shared_mutex population_lock;
+        std::mutex children_lock;
+        std::atomic<bool> done = stopCondition();
+
+        Population<T> children;
+        children.reserve(population_size_);
+
+        if (!done) prepareSelections();
+
+        /* The threads waiting for a lock execute the tasks of the nested parallel loops (e.g. in the algorithm's population update)
+         * started by the thread holding the lock, so these loops are still run in parallel without the threads deadlocking. */
+        const auto acquire = [&](auto& guard)
+        {
+            while (!guard.try_lock())
+            {
+                if (!thread_pool.try_execute_task()) std::this_thread::yield();
+            }
+        };
+
+        detail::parallel_for(detail::iota_iterator(0_sz), detail::iota_iterator(thread_pool.thread_count()), [&](size_t)
+        {
+            /* Make sure that the other threads also stop if an exception is thrown on this one. */
+            detail::scope_exit _{ [&] { done.store(true, std::memory_order_relaxed); } };
+
+            Population<T> pending_children;
+            Population<T> batch;
+            std::array<bool, 2> reused_fitness{};
+
+            while (!done.load(std::memory_order_relaxed))
+            {
+                std::shared_lock shared_guard{ population_lock, std::defer_lock };
+                acquire(shared_guard);
+
+                if (done.load(std::memory_order_relaxed)) break;
+
+                CandidatePair<T> child_pair = crossover(select(), select());
+                pending_children.clear();
+                pending_children.push_back(std::move(child_pair.first));
+                pending_children.push_back(std::move(child_pair.second));
+
+                for (size_t i = 0; i < pending_children.size(); i++)
+                {
+                    mutate(pending_children[i]);
+                    validate(pending_children[i]);
+                    repair(pending_children[i]);
+
+                    /* The fitness cache is only modified by the population updates, so it can be read while holding the shared lock. */
+                    reused_fitness[i] = reuseFitness(pending_children[i]);
+                    if (reused_fitness[i]) pending_children[i].changes.clear();
+                }
+
+                shared_guard.unlock();
+
+                for (size_t i = 0; i < pending_children.size(); i++)
+                {
+                    Candidate<T>& child = pending_children[i];
+
+                    if (!reused_fitness[i] && !evaluateDelta(child))
+                    {
+                        std::atomic_ref{ num_fitness_evals_ }.fetch_add(1, std::memory_order_release);
+                        child.fitness = (*fitness_function_)(child);
+                    }
+
+                    GAPP_ASSERT(hasValidFitness(child));
+                }
+
+                /* Discard the children if the run was stopped while they were being evaluated. */
+                if (done.load(std::memory_order_relaxed)) break;
+
+                {
+                    std::scoped_lock children_guard{ children_lock };
+
+                    for (Candidate<T>& child : pending_children)
+                    {
+                        children.push_back(std::move(child));
+                        if (children.size() == population_size_ && batch.empty()) std::swap(children, batch);
+                    }
+                }
+
+                if (batch.empty()) continue;
+
+                std::unique_lock exclusive_guard{ population_lock, std::defer_lock };
+                acquire(exclusive_guard);
+
+                if (done.load(std::memory_order_relaxed)) break;
+
+                updatePopulation(batch);
+                batch.clear();
+
+                if (keep_all_optimal_sols_) updateOptimalSolutions(solutions_, population_);
+                metrics_.update(*this);
+
+                if (on_generation_end_) on_generation_end_(*this);
+                generation_cntr_++;
+
+                if (checkpointDue()) writeCheckpoint();
+
+                done.store(stopCondition(), std::memory_order_relaxed);
+                if (!done.load(std::memory_order_relaxed)) prepareSelections();
+            }
+        });
+    }
+
+    template<typename T>
+    void GA<T>::evolve()
+    {
+        if (steady_state_) advanceSteadyState();
+        else while (!stopCondition())
+        {
+            advance();
+            if (checkpointDue()) writeCheckpoint();
+        }
+        if (!keep_all_optimal_sols_) updateOptimalSolutions(solutions_, population_);
+
+        /* Make sure the last checkpoint is complete by the time solve() returns. */
+        if (checkpoint_interval_) checkpoint_writer_->wait();
+    }
+
+    template<typename T>
+    inline bool GA<T>::checkpointDue() const noexcept
+    {
+        return checkpoint_interval_ && (generation_cntr_ % checkpoint_interval_ == 0);
+    }
+
+    template<typename T>
+    void GA<T>::writeCheckpoint()
+    {
+        GAPP_ASSERT(checkpoint_writer_ && !checkpoint_file_.empty());
+
+        if constexpr (!std::is_trivially_copyable_v<T>)
+        {
+            GAPP_THROW(std::runtime_error, "Checkpoints are only supported for trivially copyable gene types.");
+        }
+        else
+        {
+            detail::binary_writer out;
+
+            out.write(detail::CHECKPOINT_MAGIC);
+            out.write(detail::CHECKPOINT_VERSION);
+            out.write(detail::CHECKPOINT_BYTE_ORDER);
+            out.write<std::uint64_t>(sizeof(T));
+
+            out.write<std::uint64_t>(population_size_);
+            out.write<std::uint64_t>(max_gen_);
+            out.write<std::uint64_t>(generation_cntr_);
+            out.write<std::uint64_t>(num_fitness_evals());
+            out.write<std::uint64_t>(num_objectives_);
+            out.write<std::uint64_t>(num_constraints_);
+            out.write<std::uint64_t>(chrom_len());
+
+            if constexpr (is_bounded<T>) out.write_array(bounds_);
+            else out.write_array(std::span<const Bounds<T>>{});
+
+            detail::writeCandidates(out, population_);
+            detail::writeCandidates(out, solutions_.solutions());
+
+            out.write<std::uint64_t>(fitness_cache_.size());
+            fitness_cache_.for_each([&](const Candidate<T>& sol, const FitnessVector& fitness)
+            {
+                out.write_array(sol.chromosome);
+                out.write_array(std::span<const double>(fitness.data(), fitness.size()));
+            });
+
+            detail::binary_writer algorithm_state;
+            algorithm_->saveState(algorithm_state);
+            out.write_array(algorithm_state.data());
+
+            /* The generators are used concurrently by the threads in steady-state mode, so their states can't be saved. */
+            auto& thread_pool = execution_pool();
+            std::vector<std::string> rng_states(steady_state_ ? 0 : thread_pool.thread_count());
+
+            if (!rng_states.empty())
+            {
+                thread_pool.execute_on_each_thread([&](size_t thread_idx) { rng_states[thread_idx] = rng::prng.thread_state(); });
+            }
+
+            out.write<std::uint64_t>(thread_pool.scheduler_state());
+            out.write<std::uint64_t>(rng_states.size());
+            for (const std::string& rng_state : rng_states) { out.write_string(rng_state); }
+
+            checkpoint_writer_->write(checkpoint_file_, out.release());
+        }
+    }
+
     template<typename T>
     Candidates<T> GA<T>::solve(std::unique_ptr<FitnessFunctionBase<T>> fitness_function, size_t generations, Population<T> initial_population) requires (!is_bounded<T>)
     {
         GAPP_ASSERT(fitness_function, "The fitness function can't be a nullptr.");
 
         detail::restore_on_exit _{ max_gen_ };
+        detail::execution_scope scope{ execution_pool() };
 
         fitness_function_ = std::move(fitness_function);
         max_gen(generations);
 
         initializeAlgorithm({ /* no bounds */ }, std::move(initial_population));
-        while (!stopCondition())
-        {
-            advance();
-        }
-        if (!keep_all_optimal_sols_) updateOptimalSolutions(solutions_, population_);
+        evolve();
 
-        return solutions_;
+        return solutions_.solutions();
     }
 
     template<typename T>
@@ -587,18 +1073,15 @@ namespace gapp
         GAPP_ASSERT(bounds.size() == fitness_function->chrom_len(), "The length of the bounds vector must match the chromosome length.");
 
         detail::restore_on_exit _{ max_gen_ };
+        detail::execution_scope scope{ execution_pool() };
 
         fitness_function_ = std::move(fitness_function);
         max_gen(generations);
 
         initializeAlgorithm(std::move(bounds), std::move(initial_population));
-        while (!stopCondition())
-        {
-            advance();
-        }
-        if (!keep_all_optimal_sols_) updateOptimalSolutions(solutions_, population_);
+        evolve();
 
-        return solutions_;
+        return solutions_.solutions();
     }
 
     template<typename T>
@@ -681,6 +1164,30 @@ namespace gapp
         return solve(std::make_unique<F>(std::move(fitness_function)), BoundsVector<T>(chrom_len, bounds), generations, std::move(initial_population));
     }
 
+    template<typename T>
+    Candidates<T> GA<T>::solve(std::unique_ptr<FitnessFunctionBase<T>> fitness_function, const std::filesystem::path& checkpoint) requires (std::is_trivially_copyable_v<T>)
+    {
+        GAPP_ASSERT(fitness_function, "The fitness function can't be a nullptr.");
+
+        detail::restore_on_exit _{ max_gen_ };
+        detail::execution_scope scope{ execution_pool() };
+
+        fitness_function_ = std::move(fitness_function);
+
+        restoreAlgorithm(checkpoint);
+        evolve();
+
+        return solutions_.solutions();
+    }
+
+    template<typename T>
+    template<typename F>
+    requires (std::is_trivially_copyable_v<T> && std::derived_from<F, FitnessFunctionBase<T>>)
+    Candidates<T> GA<T>::solve(F fitness_function, const std::filesystem::path& checkpoint)
+    {
+        return solve(std::make_unique<F>(std::move(fitness_function)), checkpoint);
+    }
+
 } // namespace gapp
 
 #endif // !GAPP_CORE_GA_BASE_IMPL_HPP
@@ -3,8 +3,10 @@
 #include "ga_info.hpp"
 #include "../algorithm/single_objective.hpp"
 #include "../stop_condition/stop_condition.hpp"
+#include "../utility/file_io.hpp"
 #include "../utility/utility.hpp"
 #include <atomic>
+#include <filesystem>
 #include <memory>
 #include <utility>
 
@@ -28,6 +30,16 @@ namespace gapp
         return std::atomic_ref{ num_fitness_evals_ }.load(std::memory_order_acquire);
     }
 
+    void GaInfo::checkpoint(std::filesystem::path file, size_t interval)
+    {
+        const bool enable = !file.empty() && interval != 0;
+
+        checkpoint_file_ = enable ? std::move(file) : std::filesystem::path{};
+        checkpoint_interval_ = enable ? interval : 0;
+
+        if (enable && !checkpoint_writer_) checkpoint_writer_ = std::make_unique<detail::async_file_writer>();
+    }
+
     void GaInfo::algorithm(std::unique_ptr<algorithm::Algorithm> f)
     {
         use_default_algorithm_ = !f;
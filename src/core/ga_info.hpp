@@ -6,11 +6,13 @@
 #include "population.hpp"
 #include "fitness_function.hpp"
 #include "../utility/bounded_value.hpp"
+#include "../utility/thread_pool.hpp"
 #include "../utility/utility.hpp"
 #include "../metrics/metric_set.hpp"
 #include <functional>
 #include <type_traits>
 #include <concepts>
+#include <filesystem>
 #include <memory>
 #include <cstddef>
 
@@ -26,6 +28,12 @@ namespace gapp::stopping
 
 } // namespace gapp::stopping
 
+namespace gapp::detail
+{
+    class async_file_writer;
+
+} // namespace gapp::detail
+
 
 namespace gapp
 {
@@ -338,6 +346,106 @@ namespace gapp
         [[nodiscard]]
         bool keep_all_optimal_solutions() const noexcept { return keep_all_optimal_sols_; }
 
+        /**
+        * Set the maximum number of optimal solutions kept when keep_all_optimal_solutions() is set.
+        * When the number of optimal solutions found exceeds this limit, the solutions with the
+        * lowest crowding distances are removed from the solution set. \n
+        * 
+        * The number of solutions is not limited by default.
+        * 
+        * @param limit The maximum number of optimal solutions kept. A value of 0 means no limit.
+        */
+        void max_optimal_solutions(size_t limit) noexcept { max_optimal_sols_ = limit; }
+
+        /** @returns The maximum number of optimal solutions kept, or 0 if the number is not limited. */
+        [[nodiscard]]
+        size_t max_optimal_solutions() const noexcept { return max_optimal_sols_; }
+
+        /**
+        * When set to true, the %GA will use an asynchronous steady-state evolution model instead
+        * of the default generational one. \n
+        * In the generational model, every child of a generation is created and evaluated before
+        * any of them are added to the population, so the threads evaluating the cheaper children
+        * have to wait for the most expensive evaluation to finish. In the steady-state model, each
+        * thread breeds and evaluates new children independently of the other threads, without
+        * waiting for them. The evaluated children are inserted into the population using the
+        * replacement method of the algorithm as soon as population_size() of them are available,
+        * and every new child is bred from the latest population.
+        *
+        * A generation corresponds to population_size() fitness evaluations in this mode, so the
+        * max_gen() limit, the stop conditions, the metrics, and the on_generation_end() callback
+        * all work the same way as for the generational model.
+        *
+        * Disabled by default. \n
+        *
+        * @note The steady-state model is mainly useful for fitness functions with highly varying
+        *   evaluation times. The fitness functions are never called using batch evaluation in this mode.
+        *
+        * @warning The results of the runs are not reproducible in this mode when using multiple threads,
+        *   since the order in which the children are inserted into the population depends on the
+        *   evaluation times of the children.
+        *
+        * @param enable Whether the steady-state evolution model should be used.
+        */
+        void steady_state(bool enable) noexcept { steady_state_ = enable; }
+
+        /** @returns True if the asynchronous steady-state evolution model is used. */
+        [[nodiscard]]
+        bool steady_state() const noexcept { return steady_state_; }
+
+        /**
+        * Enable writing checkpoints of the state of the %GA to a file during the runs. A checkpoint
+        * is written at the end of every @p interval-th generation, and it can be used to resume the
+        * run later (e.g. after the process was terminated) using the overload of solve() that
+        * takes the path of a checkpoint file. \n
+        * The checkpoints are written by a background thread, so the generations don't have to wait
+        * for the file writes to finish. The previous contents of the file are replaced atomically
+        * when a new checkpoint is written, so the file always contains a complete checkpoint.
+        *
+        * A checkpoint contains the population, the optimal solutions found so far, the contents of
+        * the fitness cache, the state of the algorithm, the generation and fitness evaluation counters,
+        * and the states of the random number generators used by the threads. Resuming a run from a
+        * checkpoint gives the same results as an uninterrupted run, as long as the same settings and
+        * number of threads are used for both runs.
+        *
+        * Checkpointing is disabled by default. It's only supported for encodings with trivially
+        * copyable gene types.
+        *
+        * @note The state of the stop condition and the metrics is not part of the checkpoints,
+        *   they are restarted when a run is resumed. The checkpoints written in steady-state mode
+        *   don't contain the states of the random number generators.
+        *
+        * @param file The path of the checkpoint file. Checkpointing is disabled if the path is empty.
+        * @param interval The number of generations between two checkpoints. Checkpointing is disabled if 0.
+        */
+        void checkpoint(std::filesystem::path file, size_t interval = 1);
+
+        /** @returns The path of the file the checkpoints are written to, or an empty path if checkpointing is disabled. */
+        [[nodiscard]]
+        const std::filesystem::path& checkpoint_file() const noexcept { return checkpoint_file_; }
+
+        /** @returns The number of generations between two checkpoints, or 0 if checkpointing is disabled. */
+        [[nodiscard]]
+        size_t checkpoint_interval() const noexcept { return checkpoint_interval_; }
+
+        /**
+        * Set the thread pool used to run the %GA. The parallel parts of the runs are executed on the
+        * threads of this pool instead of the global thread pool of the library, so multiple GAs can be
+        * run concurrently without interfering with each other, each of them using its own set of threads.
+        * The same pool can also be shared by multiple GAs. \n
+        * The global thread pool is used if the pool is a nullptr (this is the default).
+        *
+        * @note The number of threads used by the %GA is determined by the thread count of the pool,
+        *   execution_threads() only affects the global thread pool.
+        *
+        * @param pool The thread pool to use for the runs, or nullptr to use the global thread pool.
+        */
+        void thread_pool(std::shared_ptr<ThreadPool> pool) noexcept { thread_pool_ = std::move(pool); }
+
+        /** @returns The thread pool used to run the %GA, or nullptr if the global thread pool is used. */
+        [[nodiscard]]
+        const std::shared_ptr<ThreadPool>& thread_pool() const noexcept { return thread_pool_; }
+
         /**
         * Set a generic callback function that will be called exactly once at the end
         * of each generation of a run.
@@ -361,6 +469,15 @@ namespace gapp
         template<typename T>
         friend class GA;
 
+        template<typename G>
+        friend class IslandModel;
+
+        /* The thread pool the parallel parts of the runs are executed on. */
+        detail::thread_pool& execution_pool() const noexcept
+        {
+            return thread_pool_ ? *thread_pool_->pool_ : detail::execution_context::global_thread_pool;
+        }
+
         FitnessMatrix fitness_matrix_;
 
         std::unique_ptr<algorithm::Algorithm> algorithm_;
@@ -368,15 +485,23 @@ namespace gapp
         detail::MetricSet metrics_;
         GaInfoCallback on_generation_end_ = nullptr;
 
+        std::filesystem::path checkpoint_file_;
+        std::unique_ptr<detail::async_file_writer> checkpoint_writer_;
+        size_t checkpoint_interval_ = 0;
+
+        std::shared_ptr<ThreadPool> thread_pool_;
+
         Positive<size_t> population_size_ = DEFAULT_POPSIZE;
         Positive<size_t> max_gen_ = 500;
         size_t num_objectives_ = 0;
         size_t num_constraints_ = 0;
         size_t generation_cntr_ = 0;
         size_t num_fitness_evals_ = 0;
+        size_t max_optimal_sols_ = 0;
 
         bool keep_all_optimal_sols_ = false;
         bool use_default_algorithm_ = false;
+        bool steady_state_ = false;
 
         /** The default population size used in the %GA if none is specified. */
         static constexpr size_t DEFAULT_POPSIZE = 100;
@@ -0,0 +1,544 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#ifndef GAPP_CORE_ISLAND_MODEL_HPP
+#define GAPP_CORE_ISLAND_MODEL_HPP
+
+#include "ga_base.hpp"
+#include "candidate.hpp"
+#include "population.hpp"
+#include "pareto_archive.hpp"
+#include "fitness_function.hpp"
+#include "../algorithm/nd_sort.hpp"
+#include "../utility/thread_pool.hpp"
+#include "../utility/bounded_value.hpp"
+#include "../utility/small_vector.hpp"
+#include "../utility/rng.hpp"
+#include "../utility/utility.hpp"
+#include "../utility/scope_exit.hpp"
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <memory>
+#include <concepts>
+#include <stdexcept>
+#include <cstddef>
+
+namespace gapp
+{
+    /** The possible topologies used for the migration of the candidates between the islands of an IslandModel. */
+    enum class MigrationTopology
+    {
+        Ring,           /**< Each island sends its migrants to the next island. */
+        FullyConnected, /**< Each island sends its migrants to every other island. */
+        Random,         /**< Each island sends its migrants to a randomly selected other island. */
+    };
+
+    /**
+    * An island model genetic algorithm. The population is split into multiple sub-populations
+    * (islands) that are evolved independently of each other, with each island using its own %GA
+    * and algorithm instances. The islands periodically exchange some of their candidates
+    * (migration) according to the migration topology that is used.
+    *
+    * The islands are evolved in parallel, and they are only synchronized at the migrations,
+    * so each island can advance at its own pace between two migrations. The threads of the
+    * thread pool the model is run on (the global thread pool by default) are split between
+    * the islands, with each island getting its own thread pool of about thread_count / island_count
+    * threads (at least 1). If there are fewer threads than islands, some of the islands are
+    * evolved one after the other on the same thread. An island uses the thread pool set for
+    * it using GA::thread_pool() instead if there is one (a pool should not be shared between
+    * multiple islands if the results of the runs need to be reproducible).
+    * The results of the runs are reproducible in the same way as for the %GA class.
+    *
+    * The islands can't use the steady-state mode, and they can't write checkpoints.
+    *
+    * The islands can be configured separately using the island() method (e.g. to set the
+    * algorithm, genetic operators, or stop condition used on a particular island). The run
+    * ends once the stop condition of every island has been met.
+    *
+    * @tparam G The type of the genetic algorithm used on the islands (e.g. RCGA).
+    */
+    template<typename G>
+    class IslandModel
+    {
+    public:
+        /** The gene type of the candidates. */
+        using GeneType = typename G::GeneType;
+
+        static_assert(std::derived_from<G, GA<GeneType>>, "The island type must be derived from the GA class.");
+        static_assert(std::constructible_from<G, Positive<size_t>>, "The island type must be constructible from a population size.");
+
+        /**
+        * Create an island model with the specified number of islands.
+        *
+        * @param island_count The number of islands (sub-populations) used. Must be at least 1.
+        * @param island_population_size The population size of each island. Must be at least 1.
+        */
+        IslandModel(Positive<size_t> island_count, Positive<size_t> island_population_size);
+
+        /** @returns The number of islands. */
+        [[nodiscard]]
+        size_t island_count() const noexcept { return islands_.size(); }
+
+        /**
+        * @param idx The index of the island.
+        * @returns The %GA used on the island with the given index.
+        */
+        [[nodiscard]]
+        G& island(size_t idx) noexcept { GAPP_ASSERT(idx < islands_.size()); return *islands_[idx]; }
+
+        /**
+        * @param idx The index of the island.
+        * @returns The %GA used on the island with the given index.
+        */
+        [[nodiscard]]
+        const G& island(size_t idx) const noexcept { GAPP_ASSERT(idx < islands_.size()); return *islands_[idx]; }
+
+        /**
+        * Set the topology used for the migration of the candidates between the islands.
+        * The default topology is MigrationTopology::Ring.
+        *
+        * @param topology The migration topology to use.
+        */
+        void topology(MigrationTopology topology) noexcept { topology_ = topology; }
+
+        /** @returns The migration topology used. */
+        [[nodiscard]]
+        MigrationTopology topology() const noexcept { return topology_; }
+
+        /**
+        * Set the number of generations between the migrations.
+        * The default interval is 10 generations.
+        *
+        * @param interval The number of generations between two migrations. Must be at least 1.
+        */
+        void migration_interval(Positive<size_t> interval) noexcept { migration_interval_ = interval; }
+
+        /** @returns The number of generations between two migrations. */
+        [[nodiscard]]
+        size_t migration_interval() const noexcept { return migration_interval_; }
+
+        /**
+        * Set the number of candidates an island sends to each of its destination islands during
+        * a migration. The migrants are chosen using the selection method of the source island's
+        * algorithm, and they replace the worst candidates of the destination island. At most half
+        * of an island's population is replaced in a single migration. If an island receives more
+        * migrants than this, the same number of them is taken from each of its source islands (the
+        * remainder is taken from the sources closest to the island after it). The default value is 2.
+        *
+        * @param count The number of migrants sent to each destination island. Migration is disabled if 0.
+        */
+        void migration_size(size_t count) noexcept { migration_size_ = count; }
+
+        /** @returns The number of migrants sent to each destination island during a migration. */
+        [[nodiscard]]
+        size_t migration_size() const noexcept { return migration_size_; }
+
+        /**
+        * Set the maximum number of generations a run can last for.
+        * The default value is 500.
+        *
+        * @param max_gen The maximum number of generations. Must be at least 1.
+        */
+        void max_gen(Positive<size_t> max_gen) noexcept { max_gen_ = max_gen; }
+
+        /** @returns The maximum number of generations set for the runs. */
+        [[nodiscard]]
+        size_t max_gen() const noexcept { return max_gen_; }
+
+        /** @returns The number of generations completed in the current run so far. */
+        [[nodiscard]]
+        size_t generation_cntr() const noexcept { return generation_cntr_; }
+
+        /** @returns The total number of fitness evaluations performed on all of the islands during the run. */
+        [[nodiscard]]
+        size_t num_fitness_evals() const noexcept;
+
+        /**
+        * Find the maximum of a fitness function using the island model. The fitness function
+        * is copied to each of the islands.
+        *
+        * @throws std::invalid_argument If any of the islands uses the steady-state mode or writes checkpoints.
+        *
+        * @param fitness_function The fitness function to find the maximum of.
+        * @param generations The maximum number of generations the run can last for.
+        * @returns The pareto-optimal solutions found on all of the islands.
+        */
+        template<typename F>
+        requires (!is_bounded<GeneType> && std::derived_from<F, FitnessFunctionBase<GeneType>> && std::copy_constructible<F>)
+        Candidates<GeneType> solve(const F& fitness_function, size_t generations);
+
+        /**
+        * Find the maximum of a fitness function using the island model. The fitness function
+        * is copied to each of the islands.
+        *
+        * @throws std::invalid_argument If any of the islands uses the steady-state mode or writes checkpoints.
+        *
+        * @param fitness_function The fitness function to find the maximum of.
+        * @returns The pareto-optimal solutions found on all of the islands.
+        */
+        template<typename F>
+        requires (!is_bounded<GeneType> && std::derived_from<F, FitnessFunctionBase<GeneType>> && std::copy_constructible<F>)
+        Candidates<GeneType> solve(const F& fitness_function);
+
+        /**
+        * Find the maximum of a fitness function using the island model. The fitness function
+        * is copied to each of the islands.
+        *
+        * @throws std::invalid_argument If any of the islands uses the steady-state mode or writes checkpoints.
+        *
+        * @param fitness_function The fitness function to find the maximum of.
+        * @param bounds The lower and upper bounds of each of the chromosomes' genes.
+        * @param generations The maximum number of generations the run can last for.
+        * @returns The pareto-optimal solutions found on all of the islands.
+        */
+        template<typename F>
+        requires (is_bounded<GeneType> && std::derived_from<F, FitnessFunctionBase<GeneType>> && std::copy_constructible<F>)
+        Candidates<GeneType> solve(const F& fitness_function, BoundsVector<GeneType> bounds, size_t generations);
+
+        /**
+        * Find the maximum of a fitness function using the island model. The fitness function
+        * is copied to each of the islands.
+        *
+        * @throws std::invalid_argument If any of the islands uses the steady-state mode or writes checkpoints.
+        *
+        * @param fitness_function The fitness function to find the maximum of.
+        * @param bounds The lower and upper bounds of a gene. The same bounds will be used for every gene of the chromosomes.
+        * @param generations The maximum number of generations the run can last for.
+        * @returns The pareto-optimal solutions found on all of the islands.
+        */
+        template<typename F>
+        requires (is_bounded<GeneType> && std::derived_from<F, FitnessFunctionBase<GeneType>> && std::copy_constructible<F>)
+        Candidates<GeneType> solve(const F& fitness_function, Bounds<GeneType> bounds, size_t generations);
+
+        /**
+        * Find the maximum of a fitness function using the island model. The fitness function
+        * is copied to each of the islands.
+        *
+        * @throws std::invalid_argument If any of the islands uses the steady-state mode or writes checkpoints.
+        *
+        * @param fitness_function The fitness function to find the maximum of.
+        * @param bounds The lower and upper bounds of each of the chromosomes' genes.
+        * @returns The pareto-optimal solutions found on all of the islands.
+        */
+        template<typename F>
+        requires (is_bounded<GeneType> && std::derived_from<F, FitnessFunctionBase<GeneType>> && std::copy_constructible<F>)
+        Candidates<GeneType> solve(const F& fitness_function, BoundsVector<GeneType> bounds);
+
+        /**
+        * Find the maximum of a fitness function using the island model. The fitness function
+        * is copied to each of the islands.
+        *
+        * @throws std::invalid_argument If any of the islands uses the steady-state mode or writes checkpoints.
+        *
+        * @param fitness_function The fitness function to find the maximum of.
+        * @param bounds The lower and upper bounds of a gene. The same bounds will be used for every gene of the chromosomes.
+        * @returns The pareto-optimal solutions found on all of the islands.
+        */
+        template<typename F>
+        requires (is_bounded<GeneType> && std::derived_from<F, FitnessFunctionBase<GeneType>> && std::copy_constructible<F>)
+        Candidates<GeneType> solve(const F& fitness_function, Bounds<GeneType> bounds);
+
+    private:
+
+        using MaybeBoundsVector = typename GA<GeneType>::MaybeBoundsVector;
+
+        std::vector<std::unique_ptr<G>> islands_;
+        std::vector<std::shared_ptr<ThreadPool>> thread_pools_;
+        MigrationTopology topology_ = MigrationTopology::Ring;
+        Positive<size_t> migration_interval_ = 10;
+        size_t migration_size_ = 2;
+        Positive<size_t> max_gen_ = 500;
+        size_t generation_cntr_ = 0;
+
+        template<typename F>
+        Candidates<GeneType> run(const F& fitness_function, const MaybeBoundsVector& bounds);
+
+        small_vector<size_t> migrationDestinations(size_t source) const;
+        void migrate();
+        Candidates<GeneType> optimalSolutions();
+    };
+
+} // namespace gapp
+
+
+/* IMPLEMENTATION */
+
+namespace gapp
+{
+    template<typename G>
+    IslandModel<G>::IslandModel(Positive<size_t> island_count, Positive<size_t> island_population_size)
+    {
+        islands_.reserve(island_count);
+        thread_pools_.resize(island_count);
+        while (islands_.size() < island_count)
+        {
+            islands_.push_back(std::make_unique<G>(island_population_size));
+        }
+    }
+
+    template<typename G>
+    size_t IslandModel<G>::num_fitness_evals() const noexcept
+    {
+        size_t num_evals = 0;
+        for (const auto& island : islands_) { num_evals += island->num_fitness_evals(); }
+
+        return num_evals;
+    }
+
+    template<typename G>
+    template<typename F>
+    Candidates<typename G::GeneType> IslandModel<G>::run(const F& fitness_function, const MaybeBoundsVector& bounds)
+    {
+        for (const auto& island : islands_)
+        {
+            if (island->steady_state()) GAPP_THROW(std::invalid_argument, "The islands of an island model can't use the steady-state mode.");
+            if (island->checkpoint_interval()) GAPP_THROW(std::invalid_argument, "The islands of an island model can't write checkpoints.");
+        }
+
+        detail::thread_pool& thread_pool = detail::execution_context::current();
+        const size_t thread_count = thread_pool.thread_count();
+        const size_t island_count = islands_.size();
+
+        /*
+        * The islands without a thread pool set by the user get a slice of the threads for the duration of the run.
+        * The pools are kept between the runs, so the threads (and their random number generators) stay the same.
+        */
+        std::vector<char> uses_own_pool(island_count);
+
+        detail::scope_exit _{ [&]
+        {
+            for (size_t idx = 0; idx < island_count; idx++)
+            {
+                if (uses_own_pool[idx]) islands_[idx]->thread_pool_ = nullptr;
+            }
+        } };
+
+        for (size_t idx = 0; idx < island_count; idx++)
+        {
+            if (islands_[idx]->thread_pool_) continue;
+
+            const size_t slice = std::max(thread_count / island_count + (idx < thread_count % island_count), 1_sz);
+            if (!thread_pools_[idx] || thread_pools_[idx]->thread_count() != slice)
+            {
+                thread_pools_[idx] = std::make_shared<ThreadPool>(slice);
+            }
+
+            islands_[idx]->thread_pool_ = thread_pools_[idx];
+            uses_own_pool[idx] = true;
+        }
+
+        /*
+        * Each island is always evolved by the same thread of the pool, with the nested parallel loops running on the pool
+        * of the island. This doesn't depend on the scheduler of the pool, so it doesn't have to be reset.
+        */
+        const auto for_each_island = [&](auto&& f)
+        {
+            thread_pool.execute_on_each_thread([&](size_t thread_idx)
+            {
+                for (size_t idx = thread_idx; idx < island_count; idx += thread_count)
+                {
+                    detail::execution_scope scope{ islands_[idx]->execution_pool() };
+                    f(static_cast<GA<GeneType>&>(*islands_[idx]), idx);
+                }
+            });
+        };
+
+        generation_cntr_ = 0;
+
+        std::vector<char> running(island_count);
+        std::vector<size_t> generations(island_count);
+
+        for_each_island([&](GA<GeneType>& island, size_t idx)
+        {
+            island.rng_stream_ = idx + 1;
+            island.fitness_function_ = std::make_unique<F>(fitness_function);
+            island.max_gen(max_gen_);
+            island.initializeAlgorithm(bounds, {});
+
+            running[idx] = !island.stopCondition();
+        });
+
+        /* The islands only have to wait for each other at the migrations. */
+        while (std::any_of(running.begin(), running.end(), std::identity{}))
+        {
+            std::fill(generations.begin(), generations.end(), 0_sz);
+
+            for_each_island([&](GA<GeneType>& island, size_t idx)
+            {
+                while (running[idx] && generations[idx] < migration_interval_)
+                {
+                    island.advance();
+                    running[idx] = !island.stopCondition();
+                    generations[idx]++;
+                }
+            });
+
+            generation_cntr_ += *std::max_element(generations.begin(), generations.end());
+            if (generation_cntr_ % migration_interval_ == 0) migrate();
+        }
+
+        return optimalSolutions();
+    }
+
+    template<typename G>
+    small_vector<size_t> IslandModel<G>::migrationDestinations(size_t source) const
+    {
+        const size_t island_count = islands_.size();
+
+        switch (topology_)
+        {
+            case MigrationTopology::Ring:
+                return { (source + 1) % island_count };
+            case MigrationTopology::FullyConnected:
+            {
+                small_vector<size_t> destinations;
+                for (size_t idx = 0; idx < island_count; idx++)
+                {
+                    if (idx != source) destinations.push_back(idx);
+                }
+                return destinations;
+            }
+            case MigrationTopology::Random:
+                return { (source + rng::randomInt(1_sz, island_count - 1)) % island_count };
+            default:
+                GAPP_UNREACHABLE();
+        }
+    }
+
+    template<typename G>
+    void IslandModel<G>::migrate()
+    {
+        if (islands_.size() < 2 || migration_size_ == 0) return;
+
+        /* The migrations use a counter-based random number stream that is different from the streams of the islands. */
+        rng::StreamScope rng_stream{ islands_.size() + 1, generation_cntr_, 0, 0 };
+
+        /*
+        * The migrants are selected from every island before any of the populations are modified. The
+        * immigrants of each destination are stored grouped by their source islands, in ascending order.
+        */
+        std::vector<Population<GeneType>> immigrants(islands_.size());
+        std::vector<small_vector<size_t>> sources(islands_.size());
+
+        for (size_t source = 0; source < islands_.size(); source++)
+        {
+            GA<GeneType>& island = *islands_[source];
+
+            island.prepareSelections();
+
+            for (size_t destination : migrationDestinations(source))
+            {
+                sources[destination].push_back(source);
+                for (size_t i = 0; i < migration_size_; i++)
+                {
+                    immigrants[destination].push_back(island.select());
+                }
+            }
+        }
+
+        for (size_t destination = 0; destination < islands_.size(); destination++)
+        {
+            GA<GeneType>& island = *islands_[destination];
+
+            /* The immigrants replace the candidates in the worst pareto fronts of the island. */
+            const auto pareto_fronts = algorithm::dtl::nonDominatedSort(island.fitness_matrix_);
+            const size_t immigrant_count = std::min(immigrants[destination].size(), island.population_size() / 2);
+
+            /*
+            * If not every immigrant can be accepted, the immigrants are taken from the sources in a round-robin order, so every
+            * source contributes about the same number of them. The order starts from the first source after the destination
+            * island, so the remainders are not always taken from the sources with the lowest indices.
+            */
+            const size_t nsources = sources[destination].size();
+            const size_t first_source = std::upper_bound(sources[destination].begin(), sources[destination].end(), destination) - sources[destination].begin();
+
+            for (size_t i = 0; i < immigrant_count; i++)
+            {
+                const size_t source_idx = (first_source + i) % nsources;
+                const size_t immigrant_idx = source_idx * migration_size_ + i / nsources;
+
+                const size_t replaced_idx = (pareto_fronts.end() - 1 - i)->idx;
+                island.population_[replaced_idx] = std::move(immigrants[destination][immigrant_idx]);
+            }
+
+            island.fitness_matrix_ = detail::toFitnessMatrix(island.population_);
+
+            /* The state of the algorithm that depends on the population (e.g. the ranks of the candidates) is outdated after the migration. */
+            if (immigrant_count) island.algorithm_->initialize(island);
+        }
+    }
+
+    template<typename G>
+    Candidates<typename G::GeneType> IslandModel<G>::optimalSolutions()
+    {
+        /* The archive also removes the duplicates of the solutions found on multiple islands. */
+        detail::ParetoArchive<GeneType> solutions;
+
+        for (auto& island_ptr : islands_)
+        {
+            GA<GeneType>& island = *island_ptr;
+
+            if (!island.keep_all_optimal_sols_) island.updateOptimalSolutions(island.solutions_, island.population_);
+            solutions.insert(island.solutions_.solutions());
+        }
+
+        return std::move(solutions).solutions();
+    }
+
+    template<typename G>
+    template<typename F>
+    requires (!is_bounded<typename G::GeneType> && std::derived_from<F, FitnessFunctionBase<typename G::GeneType>> && std::copy_constructible<F>)
+    Candidates<typename G::GeneType> IslandModel<G>::solve(const F& fitness_function, size_t generations)
+    {
+        max_gen(generations);
+        return run(fitness_function, {});
+    }
+
+    template<typename G>
+    template<typename F>
+    requires (!is_bounded<typename G::GeneType> && std::derived_from<F, FitnessFunctionBase<typename G::GeneType>> && std::copy_constructible<F>)
+    Candidates<typename G::GeneType> IslandModel<G>::solve(const F& fitness_function)
+    {
+        return run(fitness_function, {});
+    }
+
+    template<typename G>
+    template<typename F>
+    requires (is_bounded<typename G::GeneType> && std::derived_from<F, FitnessFunctionBase<typename G::GeneType>> && std::copy_constructible<F>)
+    Candidates<typename G::GeneType> IslandModel<G>::solve(const F& fitness_function, BoundsVector<GeneType> bounds, size_t generations)
+    {
+        GAPP_ASSERT(bounds.size() == static_cast<const FitnessFunctionBase<GeneType>&>(fitness_function).chrom_len(),
+                    "The length of the bounds vector must match the chromosome length.");
+
+        max_gen(generations);
+        return run(fitness_function, bounds);
+    }
+
+    template<typename G>
+    template<typename F>
+    requires (is_bounded<typename G::GeneType> && std::derived_from<F, FitnessFunctionBase<typename G::GeneType>> && std::copy_constructible<F>)
+    Candidates<typename G::GeneType> IslandModel<G>::solve(const F& fitness_function, Bounds<GeneType> bounds, size_t generations)
+    {
+        const size_t chrom_len = static_cast<const FitnessFunctionBase<GeneType>&>(fitness_function).chrom_len();
+        return solve(fitness_function, BoundsVector<GeneType>(chrom_len, bounds), generations);
+    }
+
+    template<typename G>
+    template<typename F>
+    requires (is_bounded<typename G::GeneType> && std::derived_from<F, FitnessFunctionBase<typename G::GeneType>> && std::copy_constructible<F>)
+    Candidates<typename G::GeneType> IslandModel<G>::solve(const F& fitness_function, BoundsVector<GeneType> bounds)
+    {
+        return solve(fitness_function, std::move(bounds), max_gen_);
+    }
+
+    template<typename G>
+    template<typename F>
+    requires (is_bounded<typename G::GeneType> && std::derived_from<F, FitnessFunctionBase<typename G::GeneType>> && std::copy_constructible<F>)
+    Candidates<typename G::GeneType> IslandModel<G>::solve(const F& fitness_function, Bounds<GeneType> bounds)
+    {
+        return solve(fitness_function, bounds, max_gen_);
+    }
+
+} // namespace gapp
+
+#endif // !GAPP_CORE_ISLAND_MODEL_HPP
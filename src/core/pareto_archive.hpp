@@ -0,0 +1,540 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#ifndef GAPP_CORE_PARETO_ARCHIVE_HPP
+#define GAPP_CORE_PARETO_ARCHIVE_HPP
+
+#include "candidate.hpp"
+#include "population.hpp"
+#include "../utility/concepts.hpp"
+#include "../utility/math.hpp"
+#include "../utility/utility.hpp"
+#include <unordered_map>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <vector>
+#include <span>
+#include <limits>
+#include <utility>
+#include <cstddef>
+
+namespace gapp::detail
+{
+    /*
+    * A set of pareto-optimal candidates, used for storing all of the optimal solutions found during a run.
+    *
+    * The fitness vectors of the candidates are organized into an ND-tree, which is a tree of the points where each
+    * node stores the ideal and nadir points of the candidates in its subtree. A subtree can be skipped while checking
+    * whether a new candidate is dominated by any of the candidates in the archive (or dominates any of them) if the new
+    * candidate is not dominated by the ideal point of the subtree (or doesn't dominate its nadir point). Duplicate
+    * candidates are found based on the hashes of their chromosomes.
+    *
+    * The size of the archive can optionally be limited. If the number of candidates is greater than this limit
+    * after inserting new candidates, the candidates with the lowest crowding distances are removed from it.
+    *
+    * The candidates returned by solutions() are sorted by their chromosomes (lexicographically) after every
+    * insertion of a set of candidates or change of the size limit, so their order doesn't depend on the order in
+    * which they were found. Inserting a single candidate doesn't sort the candidates.
+    *
+    * See:
+    *  Jaszkiewicz, Andrzej, and Thibaut Lust. "ND-tree-based update: a fast algorithm for the dynamic nondominance problem."
+    *  IEEE Transactions on Evolutionary Computation 22, no. 5 (2018): 778-791.
+    */
+    template<typename T>
+    class ParetoArchive
+    {
+    public:
+        ParetoArchive() = default;
+
+        /* Create an archive that keeps at most max_size candidates. A max_size of 0 means that the size is not limited. */
+        explicit ParetoArchive(size_t max_size) noexcept :
+            max_size_(max_size)
+        {}
+
+        /* Insert a candidate into the archive if it's not dominated by any of the candidates in the archive, and
+         * isn't a duplicate of one either. The candidates dominated by it are removed. Returns true if it was inserted. */
+        bool insert(Candidate<T> sol);
+
+        /* Insert each of the candidates into the archive, prune the archive if it became larger than its size limit, and sort the candidates. */
+        void insert(Candidates<T> sols);
+
+        /* Remove every candidate from the archive. */
+        void clear() noexcept;
+
+        /* Set the maximum number of candidates in the archive. A limit of 0 means that the size is not limited. */
+        void max_size(size_t limit);
+        size_t max_size() const noexcept { return max_size_; }
+
+        const Candidates<T>& solutions() const& noexcept { return solutions_; }
+        Candidates<T> solutions() && noexcept { return std::move(solutions_); }
+
+        size_t size() const noexcept { return solutions_.size(); }
+        bool empty() const noexcept { return solutions_.empty(); }
+
+    private:
+        struct Node
+        {
+            FitnessVector ideal;            // The componentwise maximum of the points in the subtree
+            FitnessVector nadir;            // The componentwise minimum of the points in the subtree
+            std::vector<size_t> children;   // The indices of the child nodes (only for internal nodes)
+            std::vector<size_t> points;     // The indices of the candidates in the node (only for leaf nodes)
+            size_t parent = NONE;
+            bool is_leaf = true;
+        };
+
+        Candidates<T> solutions_;
+        std::vector<size_t> leaf_of_;                       // The leaf node each candidate is stored in
+        std::unordered_multimap<size_t, size_t> hashes_;    // The chromosome hashes of the candidates
+
+        std::vector<Node> nodes_;
+        std::vector<size_t> free_nodes_;
+        size_t root_ = NONE;
+
+        size_t max_size_ = 0;
+
+        static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+        static constexpr size_t MAX_LEAF_SIZE = 20;
+
+        static size_t chromosomeHash(const Candidate<T>& sol) noexcept;
+        bool isDuplicate(const Candidate<T>& sol, size_t hash) const noexcept;
+
+        std::span<const double> point(size_t idx) const noexcept { return solutions_[idx].fitness; }
+
+        bool isDominated(size_t node, std::span<const double> fvec) const noexcept;
+        void removeDominated(size_t node, std::span<const double> fvec, std::vector<size_t>& removed, std::vector<size_t>& changed_leaves);
+        void updateChangedLeaf(size_t leaf);
+
+        void insertIntoTree(size_t idx);
+        void splitLeaf(size_t node);
+
+        void removeFromLeaf(size_t idx);
+        void eraseSolutions(std::vector<size_t> indices);
+        void eraseEmptyNode(size_t node);
+        void recalcBounds(size_t node);
+
+        size_t newNode(size_t parent);
+        void extendBounds(Node& node, std::span<const double> fvec) const;
+
+        void prune();
+        void sortSolutions();
+    };
+
+} // namespace gapp::detail
+
+
+/* IMPLEMENTATION */
+
+namespace gapp::detail
+{
+    template<typename T>
+    bool ParetoArchive<T>::insert(Candidate<T> sol)
+    {
+        GAPP_ASSERT(sol.is_evaluated());
+        GAPP_ASSERT(empty() || sol.fitness.size() == solutions_[0].fitness.size());
+
+        const size_t hash = chromosomeHash(sol);
+
+        if (isDuplicate(sol, hash)) return false;
+        if (root_ != NONE && isDominated(root_, sol.fitness)) return false;
+
+        if (root_ != NONE)
+        {
+            std::vector<size_t> removed;
+            std::vector<size_t> changed_leaves;
+
+            removeDominated(root_, sol.fitness, removed, changed_leaves);
+
+            for (size_t leaf : changed_leaves) updateChangedLeaf(leaf);
+            eraseSolutions(std::move(removed));
+        }
+
+        solutions_.push_back(std::move(sol));
+        leaf_of_.push_back(NONE);
+        hashes_.emplace(hash, solutions_.size() - 1);
+        insertIntoTree(solutions_.size() - 1);
+
+        return true;
+    }
+
+    template<typename T>
+    void ParetoArchive<T>::insert(Candidates<T> sols)
+    {
+        for (Candidate<T>& sol : sols) insert(std::move(sol));
+
+        if (max_size_ && size() > max_size_) prune();
+        sortSolutions();
+    }
+
+    template<typename T>
+    void ParetoArchive<T>::clear() noexcept
+    {
+        solutions_.clear();
+        leaf_of_.clear();
+        hashes_.clear();
+        nodes_.clear();
+        free_nodes_.clear();
+        root_ = NONE;
+    }
+
+    template<typename T>
+    void ParetoArchive<T>::max_size(size_t limit)
+    {
+        max_size_ = limit;
+        if (max_size_ && size() > max_size_) prune();
+        sortSolutions();
+    }
+
+    template<typename T>
+    size_t ParetoArchive<T>::chromosomeHash(const Candidate<T>& sol) noexcept
+    {
+        /* Gene types without a hash function all use the same hash, and are only compared based on their chromosomes. */
+        if constexpr (detail::hashable<T>) return CandidateHasher<T>{}(sol);
+        else return 0;
+    }
+
+    template<typename T>
+    bool ParetoArchive<T>::isDuplicate(const Candidate<T>& sol, size_t hash) const noexcept
+    {
+        /* The chromosomes are compared exactly, as the approximate comparison of floating-point genes is not transitive. */
+        const auto [first, last] = hashes_.equal_range(hash);
+
+        return std::any_of(first, last, [&](const auto& entry) { return solutions_[entry.second].chromosome == sol.chromosome; });
+    }
+
+    template<typename T>
+    bool ParetoArchive<T>::isDominated(size_t node_idx, std::span<const double> fvec) const noexcept
+    {
+        const Node& node = nodes_[node_idx];
+
+        /* None of the points in the node can dominate fvec if it's greater than their ideal point in any objective. */
+        for (size_t i = 0; i < fvec.size(); i++)
+        {
+            if (math::floatIsLess(node.ideal[i], fvec[i])) return false;
+        }
+
+        if (node.is_leaf)
+        {
+            return std::any_of(node.points.begin(), node.points.end(), [&](size_t idx) { return math::paretoCompareLess(fvec, point(idx)); });
+        }
+
+        return std::any_of(node.children.begin(), node.children.end(), [&](size_t child) { return isDominated(child, fvec); });
+    }
+
+    template<typename T>
+    void ParetoArchive<T>::removeDominated(size_t node_idx, std::span<const double> fvec, std::vector<size_t>& removed, std::vector<size_t>& changed_leaves)
+    {
+        Node& node = nodes_[node_idx];
+
+        /* fvec can't dominate any of the points in the node if it's less than their nadir point in any objective. */
+        for (size_t i = 0; i < fvec.size(); i++)
+        {
+            if (math::floatIsLess(fvec[i], node.nadir[i])) return;
+        }
+
+        if (!node.is_leaf)
+        {
+            for (size_t child : node.children) removeDominated(child, fvec, removed, changed_leaves);
+            return;
+        }
+
+        const size_t removed_before = removed.size();
+
+        std::erase_if(node.points, [&](size_t idx)
+        {
+            const bool is_dominated = math::paretoCompareLess(point(idx), fvec);
+            if (is_dominated) removed.push_back(idx);
+            return is_dominated;
+        });
+
+        if (removed.size() != removed_before) changed_leaves.push_back(node_idx);
+    }
+
+    template<typename T>
+    void ParetoArchive<T>::updateChangedLeaf(size_t leaf)
+    {
+        if (nodes_[leaf].points.empty()) eraseEmptyNode(leaf);
+        else for (size_t node = leaf; node != NONE; node = nodes_[node].parent) recalcBounds(node);
+    }
+
+    template<typename T>
+    void ParetoArchive<T>::insertIntoTree(size_t idx)
+    {
+        const auto fvec = point(idx);
+
+        if (root_ == NONE) root_ = newNode(NONE);
+
+        size_t node_idx = root_;
+
+        while (!nodes_[node_idx].is_leaf)
+        {
+            extendBounds(nodes_[node_idx], fvec);
+
+            /* Insert into the child node whose center is the closest to the new point. */
+            const auto& children = nodes_[node_idx].children;
+            node_idx = *std::min_element(children.begin(), children.end(), [&](size_t lhs, size_t rhs)
+            {
+                auto center_dist = [&](const Node& node)
+                {
+                    double dist = 0.0;
+                    for (size_t i = 0; i < fvec.size(); i++)
+                    {
+                        const double diff = fvec[i] - 0.5 * (node.ideal[i] + node.nadir[i]);
+                        dist += diff * diff;
+                    }
+                    return dist;
+                };
+                return center_dist(nodes_[lhs]) < center_dist(nodes_[rhs]);
+            });
+        }
+
+        extendBounds(nodes_[node_idx], fvec);
+        nodes_[node_idx].points.push_back(idx);
+        leaf_of_[idx] = node_idx;
+
+        if (nodes_[node_idx].points.size() > MAX_LEAF_SIZE) splitLeaf(node_idx);
+    }
+
+    template<typename T>
+    void ParetoArchive<T>::splitLeaf(size_t node_idx)
+    {
+        const std::vector<size_t>& points = nodes_[node_idx].points;
+
+        const size_t nobjectives = point(points[0]).size();
+        const size_t nchildren = std::min(nobjectives + 1, points.size());
+
+        auto distance = [&](size_t lhs, size_t rhs) { return math::euclideanDistanceSq(point(lhs), point(rhs)); };
+
+        /* Select the seed points of the children so that they are far away from each other. */
+        std::vector<size_t> seeds = { points[0] };
+        std::vector<double> seed_distances(points.size(), math::inf<double>);
+
+        while (seeds.size() < nchildren)
+        {
+            for (size_t i = 0; i < points.size(); i++)
+            {
+                seed_distances[i] = std::min(seed_distances[i], distance(points[i], seeds.back()));
+            }
+            const size_t farthest = std::max_element(seed_distances.begin(), seed_distances.end()) - seed_distances.begin();
+            if (seed_distances[farthest] == 0.0) break;
+            seeds.push_back(points[farthest]);
+        }
+
+        /* All of the points are the same, splitting the node wouldn't help. */
+        if (seeds.size() == 1) return;
+
+        const std::vector<size_t> leaf_points = std::move(nodes_[node_idx].points);
+        nodes_[node_idx].points.clear();
+        nodes_[node_idx].is_leaf = false;
+
+        for (size_t i = 0; i < seeds.size(); i++)
+        {
+            const size_t child = newNode(node_idx);
+            nodes_[node_idx].children.push_back(child);
+        }
+
+        /* Assign every point to the child of the closest seed. */
+        for (size_t idx : leaf_points)
+        {
+            const auto closest = std::min_element(seeds.begin(), seeds.end(), [&](size_t lhs, size_t rhs) { return distance(idx, lhs) < distance(idx, rhs); });
+            const size_t child = nodes_[node_idx].children[closest - seeds.begin()];
+
+            extendBounds(nodes_[child], point(idx));
+            nodes_[child].points.push_back(idx);
+            leaf_of_[idx] = child;
+        }
+    }
+
+    template<typename T>
+    void ParetoArchive<T>::removeFromLeaf(size_t idx)
+    {
+        const size_t leaf = leaf_of_[idx];
+
+        std::erase(nodes_[leaf].points, idx);
+        updateChangedLeaf(leaf);
+    }
+
+    template<typename T>
+    void ParetoArchive<T>::eraseSolutions(std::vector<size_t> indices)
+    {
+        /* The candidates are removed by moving the last candidate into their place. Removing them in descending
+         * order ensures that the candidate moved is never one that is also going to be removed. */
+        std::sort(indices.begin(), indices.end(), std::greater{});
+
+        for (size_t idx : indices)
+        {
+            const size_t last = solutions_.size() - 1;
+
+            auto erase_hash = [&](size_t sol_idx)
+            {
+                const auto [first, end] = hashes_.equal_range(chromosomeHash(solutions_[sol_idx]));
+                hashes_.erase(std::find_if(first, end, [&](const auto& entry) { return entry.second == sol_idx; }));
+            };
+
+            erase_hash(idx);
+
+            if (idx != last)
+            {
+                erase_hash(last);
+                hashes_.emplace(chromosomeHash(solutions_[last]), idx);
+
+                auto& leaf_points = nodes_[leaf_of_[last]].points;
+                *std::find(leaf_points.begin(), leaf_points.end(), last) = idx;
+
+                solutions_[idx] = std::move(solutions_[last]);
+                leaf_of_[idx] = leaf_of_[last];
+            }
+
+            solutions_.pop_back();
+            leaf_of_.pop_back();
+        }
+    }
+
+    template<typename T>
+    void ParetoArchive<T>::eraseEmptyNode(size_t node_idx)
+    {
+        const size_t parent = nodes_[node_idx].parent;
+
+        nodes_[node_idx] = Node{};
+        free_nodes_.push_back(node_idx);
+
+        if (parent == NONE)
+        {
+            root_ = NONE;
+            return;
+        }
+
+        std::erase(nodes_[parent].children, node_idx);
+
+        if (nodes_[parent].children.empty()) eraseEmptyNode(parent);
+        else for (size_t node = parent; node != NONE; node = nodes_[node].parent) recalcBounds(node);
+    }
+
+    template<typename T>
+    void ParetoArchive<T>::recalcBounds(size_t node_idx)
+    {
+        Node& node = nodes_[node_idx];
+
+        node.ideal.assign(node.ideal.size(), -math::inf<double>);
+        node.nadir.assign(node.nadir.size(), math::inf<double>);
+
+        if (node.is_leaf)
+        {
+            for (size_t idx : node.points) extendBounds(node, point(idx));
+            return;
+        }
+
+        for (size_t child : node.children)
+        {
+            extendBounds(node, nodes_[child].ideal);
+            extendBounds(node, nodes_[child].nadir);
+        }
+    }
+
+    template<typename T>
+    size_t ParetoArchive<T>::newNode(size_t parent)
+    {
+        size_t node_idx = nodes_.size();
+
+        if (!free_nodes_.empty())
+        {
+            node_idx = free_nodes_.back();
+            free_nodes_.pop_back();
+        }
+        else nodes_.emplace_back();
+
+        nodes_[node_idx].parent = parent;
+
+        return node_idx;
+    }
+
+    template<typename T>
+    void ParetoArchive<T>::extendBounds(Node& node, std::span<const double> fvec) const
+    {
+        if (node.ideal.empty())
+        {
+            node.ideal = FitnessVector(fvec.begin(), fvec.end());
+            node.nadir = FitnessVector(fvec.begin(), fvec.end());
+            return;
+        }
+
+        for (size_t i = 0; i < fvec.size(); i++)
+        {
+            node.ideal[i] = std::max(node.ideal[i], fvec[i]);
+            node.nadir[i] = std::min(node.nadir[i], fvec[i]);
+        }
+    }
+
+    template<typename T>
+    void ParetoArchive<T>::prune()
+    {
+        GAPP_ASSERT(max_size_ != 0 && size() > max_size_);
+
+        /* Crowding distances of the candidates, the extreme points of each objective have infinite distances. */
+        std::vector<double> distances(size(), 0.0);
+        std::vector<size_t> indices(size());
+
+        for (size_t obj = 0; obj < solutions_[0].fitness.size(); obj++)
+        {
+            std::iota(indices.begin(), indices.end(), 0_sz);
+            std::sort(indices.begin(), indices.end(), [&](size_t lhs, size_t rhs) { return point(lhs)[obj] < point(rhs)[obj]; });
+
+            const double interval = std::max(point(indices.back())[obj] - point(indices.front())[obj], 1E-8);
+
+            distances[indices.front()] = math::inf<double>;
+            distances[indices.back()]  = math::inf<double>;
+
+            for (size_t i = 1; i < indices.size() - 1; i++)
+            {
+                distances[indices[i]] += (point(indices[i + 1])[obj] - point(indices[i - 1])[obj]) / interval;
+            }
+        }
+
+        std::iota(indices.begin(), indices.end(), 0_sz);
+        std::nth_element(indices.begin(), indices.begin() + (size() - max_size_), indices.end(), [&](size_t lhs, size_t rhs)
+        {
+            return distances[lhs] < distances[rhs];
+        });
+        indices.resize(size() - max_size_);
+
+        for (size_t idx : indices) removeFromLeaf(idx);
+        eraseSolutions(std::move(indices));
+    }
+
+    template<typename T>
+    void ParetoArchive<T>::sortSolutions()
+    {
+        auto chrom_less = [](const Candidate<T>& lhs, const Candidate<T>& rhs) { return lhs.chromosome < rhs.chromosome; };
+
+        if (std::is_sorted(solutions_.begin(), solutions_.end(), chrom_less)) return;
+
+        std::vector<size_t> order(size());
+        std::iota(order.begin(), order.end(), 0_sz);
+        std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) { return chrom_less(solutions_[lhs], solutions_[rhs]); });
+
+        /* The indices stored in the tree and the hash map have to be updated to the new positions of the candidates. */
+        std::vector<size_t> new_idx(size());
+        for (size_t i = 0; i < order.size(); i++) new_idx[order[i]] = i;
+
+        Candidates<T> sorted_solutions;
+        sorted_solutions.reserve(size());
+        std::vector<size_t> sorted_leaf_of(size());
+
+        for (size_t i = 0; i < order.size(); i++)
+        {
+            sorted_solutions.push_back(std::move(solutions_[order[i]]));
+            sorted_leaf_of[i] = leaf_of_[order[i]];
+        }
+
+        solutions_ = std::move(sorted_solutions);
+        leaf_of_ = std::move(sorted_leaf_of);
+
+        for (Node& node : nodes_)
+        {
+            for (size_t& idx : node.points) idx = new_idx[idx];
+        }
+        for (auto& entry : hashes_) entry.second = new_idx[entry.second];
+    }
+
+} // namespace gapp::detail
+
+#endif // !GAPP_CORE_PARETO_ARCHIVE_HPP
@@ -4,9 +4,13 @@
 #include "../utility/math.hpp"
 #include "../utility/algorithm.hpp"
 #include "../utility/functional.hpp"
+#include "../utility/iterators.hpp"
+#include "../utility/thread_pool.hpp"
 #include <algorithm>
 #include <iterator>
 #include <vector>
+#include <span>
+#include <utility>
 #include <cstddef>
 
 namespace gapp::detail
@@ -46,7 +50,13 @@ namespace gapp::detail
     {
         if (fmat.empty()) return {};
 
-        return (fmat.ncols() == 1) ? findParetoFront1D(fmat) : findParetoFrontBest(fmat);
+        if (fmat.ncols() == 1) return findParetoFront1D(fmat);
+
+        /* The BEST algorithm is faster if the front is small compared to the number of points, but the front is usually
+         * large with many objectives, and the parallel divide-and-conquer algorithm scales much better in that case. */
+        const bool use_parallel = (fmat.ncols() > 2) && (fmat.size() >= PARALLEL_PARETO_FRONT_THRESHOLD);
+
+        return use_parallel ? findParetoFrontKungParallel(fmat) : findParetoFrontBest(fmat);
     }
 
     small_vector<size_t> findParetoFront1D(const FitnessMatrix& fmat)
@@ -196,6 +206,102 @@ namespace gapp::detail
         return findParetoFrontKungImpl(fmat, indices.cbegin(), indices.cend());
     }
 
+    /* A pareto front found by findParetoFrontKungParallelImpl, with the fitness vectors of the front stored contiguously. */
+    struct ParetoFrontBlock
+    {
+        small_vector<size_t> indices;
+        FitnessMatrix points;
+    };
+
+    /* Filter the points of bottom dominated by any of the points of top, and append the rest to top. */
+    static void mergeParetoFrontBlocks(ParetoFrontBlock& top, const ParetoFrontBlock& bottom)
+    {
+        const std::span<const double> top_points(top.points.data(), top.points.size() * top.points.ncols());
+
+        std::vector<char> is_dominated(bottom.indices.size());
+
+        detail::parallel_for(detail::iota_iterator(0_sz), detail::iota_iterator(bottom.indices.size()), 64, [&](size_t i)
+        {
+            is_dominated[i] = math::paretoDominatedByAny(bottom.points[i], top_points);
+        });
+
+        for (size_t i = 0; i < bottom.indices.size(); i++)
+        {
+            if (is_dominated[i]) continue;
+
+            top.indices.push_back(bottom.indices[i]);
+            top.points.append_row(bottom.points[i]);
+        }
+    }
+
+    /* Find the pareto front of the points in [first, last), assuming the points are sorted in lexicographically descending order. */
+    static ParetoFrontBlock findParetoFrontKungParallelImpl(const FitnessMatrix& fmat, const size_t* first, const size_t* last)
+    {
+        /* The number of points below which the front of a range is found serially. */
+        constexpr size_t SERIAL_THRESHOLD = 512;
+
+        const size_t size = size_t(last - first);
+
+        if (size <= SERIAL_THRESHOLD)
+        {
+            ParetoFrontBlock front;
+            front.points.reserve(size, fmat.ncols());
+
+            /* A point can only be dominated by the points before it in the lexicographical order. */
+            for (const size_t* it = first; it != last; ++it)
+            {
+                const std::span<const double> front_points(front.points.data(), front.points.size() * fmat.ncols());
+                if (math::paretoDominatedByAny(fmat[*it], front_points)) continue;
+
+                front.indices.push_back(*it);
+                front.points.append_row(fmat[*it]);
+            }
+
+            return front;
+        }
+
+        const size_t* middle = first + size / 2;
+
+        ParetoFrontBlock halves[2];
+        detail::parallel_for(detail::iota_iterator(0_sz), detail::iota_iterator(2_sz), [&](size_t half)
+        {
+            halves[half] = half == 0 ? findParetoFrontKungParallelImpl(fmat, first, middle) : findParetoFrontKungParallelImpl(fmat, middle, last);
+        });
+
+        /* The points of the bottom half can't dominate the points of the top half because of the ordering. */
+        mergeParetoFrontBlocks(halves[0], halves[1]);
+
+        return std::move(halves[0]);
+    }
+
+    small_vector<size_t> findParetoFrontKungParallel(const FitnessMatrix& fmat)
+    {
+        /* Same as findParetoFrontKung(), but the recursive calls and the merge steps are executed on the thread pool. */
+        /* Doesn't work for d = 1 (single-objective optimization). */
+
+        if (fmat.empty()) return {};
+
+        /* The points are sorted by their first objective, the rest of the objectives are only compared for ties. */
+        std::vector<std::pair<double, size_t>> keys(fmat.size());
+        for (size_t i = 0; i < fmat.size(); i++) keys[i] = { fmat(i, 0), i };
+
+        std::sort(keys.begin(), keys.end(), [&](const auto& lhs, const auto& rhs) noexcept
+        {
+            if (lhs.first != rhs.first) return lhs.first > rhs.first;
+
+            for (size_t obj = 1; obj < fmat.ncols(); obj++)
+            {
+                if (fmat(lhs.second, obj) != fmat(rhs.second, obj)) return fmat(lhs.second, obj) > fmat(rhs.second, obj);
+            }
+            return false;
+        });
+
+        std::vector<size_t> indices(fmat.size());
+        std::transform(keys.begin(), keys.end(), indices.begin(), [](const auto& key) { return key.second; });
+
+        return findParetoFrontKungParallelImpl(fmat, indices.data(), indices.data() + indices.size()).indices;
+    }
+
     FitnessVector findNadirPoint(const FitnessMatrix& fitness_matrix)
     {
         if (fitness_matrix.empty()) return {};
@@ -45,12 +45,16 @@ namespace gapp::detail
     template<typename T>
     Candidates<T> findParetoFront(const Population<T>& pop);
 
+    /* The number of points above which findParetoFront() uses the parallel divide-and-conquer algorithm for more than 2 objectives. */
+    inline constexpr size_t PARALLEL_PARETO_FRONT_THRESHOLD = 2048;
+
     small_vector<size_t> findParetoFront(const FitnessMatrix& fmat);
 
     small_vector<size_t> findParetoFront1D(const FitnessMatrix& fmat);
     small_vector<size_t> findParetoFrontSort(const FitnessMatrix& fmat);
     small_vector<size_t> findParetoFrontBest(const FitnessMatrix& fmat);
     small_vector<size_t> findParetoFrontKung(const FitnessMatrix& fmat);
+    small_vector<size_t> findParetoFrontKungParallel(const FitnessMatrix& fmat);
 
     /* Find the pareto-optimal solutions in the set (lhs U rhs), assuming both lhs and rhs are pareto sets. */
     template<typename T>
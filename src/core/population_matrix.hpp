@@ -0,0 +1,219 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#ifndef GAPP_CORE_POPULATION_MATRIX_HPP
+#define GAPP_CORE_POPULATION_MATRIX_HPP
+
+#include "candidate.hpp"
+#include "../utility/matrix.hpp"
+#include "../utility/utility.hpp"
+#include <span>
+#include <functional>
+#include <cstddef>
+
+namespace gapp
+{
+    /**
+    * The class used to represent the chromosomes of multiple candidates with the same chromosome length.
+    * Each row of the matrix is the chromosome of a candidate.
+    * 
+    * The size of a chromosome matrix is: [ number_of_candidates x chromosome_length ].
+    * 
+    * @tparam T The gene type.
+    */
+    template<typename T>
+    using ChromosomeMatrix = detail::Matrix<T>;
+
+    /**
+    * The class used to represent the constraint violations of multiple candidates.
+    * Each row of the matrix is the constraint violation vector of a candidate.
+    * 
+    * The size of a constraint violation matrix is: [ number_of_candidates x number_of_constraints ].
+    */
+    using CVMatrix = detail::Matrix<double>;
+
+    /**
+    * A non-owning view of a candidate solution stored in a PopulationMatrix.
+    * The chromosome, fitness vector, and constraint violation vector of the candidate
+    * refer to the rows of the corresponding matrices of the population matrix.
+    * 
+    * @tparam T The gene type used in the candidate's chromosome.
+    */
+    template<typename T>
+    struct CandidateView : public detail::container_interface<CandidateView<T>>
+    {
+        using Gene = T; /**< The type of the candidate's genes. */
+
+        /** The chromosome of the candidate. */
+        std::span<const T> chromosome;
+
+        /** The fitness vector of the candidate. Empty if the candidate hasn't been evaluated. */
+        std::span<const double> fitness;
+
+        /** The constraint violation vector of the candidate. Empty if there are no constraints. */
+        std::span<const double> constraint_violation;
+
+
+        /** @returns An iterator to the beginning of the candidate's chromosome. */
+        auto begin() const noexcept { return chromosome.begin(); }
+
+        /** @returns An iterator to the end of the candidate's chromosome. */
+        auto end() const noexcept { return chromosome.end(); }
+
+        /** @returns The length of the chromosome. */
+        size_t chrom_len() const noexcept { return chromosome.size(); }
+
+        /** @returns The number of objectives, or 0 if the candidate hasn't been evaluated. */
+        size_t num_objectives() const noexcept { return fitness.size(); }
+
+        /** @returns True if the candidate has a fitness vector associated with it. */
+        bool is_evaluated() const noexcept { return !fitness.empty(); }
+
+        /** @returns The number of constraints associated with the candidate. */
+        size_t num_constraints() const noexcept { return constraint_violation.size(); }
+    };
+
+    /**
+    * A population of candidates with the same chromosome length, stored in a structure-of-arrays
+    * layout. The chromosomes of the candidates are stored in a single contiguous buffer (one row
+    * for each candidate), while their fitness and constraint violation vectors are stored in separate
+    * matrices. This layout allows population-wide operations (e.g. the evaluation of the candidates)
+    * to process the genes of the candidates without chasing pointers, and to be vectorized more easily.
+    * 
+    * The storage of the matrices is reused when new candidates are assigned to the population matrix.
+    * 
+    * @tparam T The gene type used in the chromosomes of the candidates.
+    */
+    template<typename T>
+    class PopulationMatrix
+    {
+    public:
+        /** Create an empty population matrix. */
+        PopulationMatrix() = default;
+
+        /**
+        * Create a population matrix from a set of candidates.
+        * 
+        * @param sols The candidates to store in the population matrix. Their chromosomes must be the same length.
+        */
+        explicit PopulationMatrix(std::span<const Candidate<T>> sols) { assign(sols); }
+
+        /**
+        * Replace the contents of the population matrix with a set of candidates.
+        * The fitness and constraint violation matrices will only contain the values of the candidates
+        * if these are the same size for every candidate, otherwise they will be empty.
+        * 
+        * @param sols The candidates to store in the population matrix. Their chromosomes must be the same length.
+        */
+        void assign(std::span<const Candidate<T>> sols) { assignImpl(sols, std::identity{}); }
+
+        /**
+        * Replace the contents of the population matrix with a set of candidates.
+        * The fitness and constraint violation matrices will only contain the values of the candidates
+        * if these are the same size for every candidate, otherwise they will be empty.
+        * 
+        * @param sols Pointers to the candidates to store in the population matrix. Their chromosomes must be the same length.
+        */
+        void assign(std::span<const Candidate<T>* const> sols) { assignImpl(sols, [](const Candidate<T>* sol) -> const Candidate<T>& { return *sol; }); }
+
+        /** @returns A view of the candidate at the given index. */
+        [[nodiscard]]
+        CandidateView<T> operator[](size_t idx) const noexcept
+        {
+            GAPP_ASSERT(idx < size(), "Index out of bounds.");
+
+            CandidateView<T> view;
+            view.chromosome = std::span{ chromosomes_.data() + idx * chrom_len_, chrom_len_ };
+            if (!fitness_matrix_.empty()) view.fitness = fitness_matrix_[idx];
+            if (!cv_matrix_.empty()) view.constraint_violation = cv_matrix_[idx];
+
+            return view;
+        }
+
+        /** @returns The number of candidates in the population matrix. */
+        [[nodiscard]]
+        size_t size() const noexcept { return size_; }
+
+        /** @returns True if the population matrix doesn't contain any candidates. */
+        [[nodiscard]]
+        bool empty() const noexcept { return size_ == 0; }
+
+        /** @returns The chromosome length of the candidates. */
+        [[nodiscard]]
+        size_t chrom_len() const noexcept { return chrom_len_; }
+
+        /** @returns The chromosomes of the candidates. The i-th row is the chromosome of the i-th candidate. */
+        [[nodiscard]]
+        const ChromosomeMatrix<T>& chromosomes() const noexcept { return chromosomes_; }
+
+        /** @returns The fitness matrix of the candidates. Empty if the candidates haven't been evaluated. */
+        [[nodiscard]]
+        const FitnessMatrix& fitness_matrix() const noexcept { return fitness_matrix_; }
+
+        /** @returns The constraint violation matrix of the candidates. Empty if there are no constraints. */
+        [[nodiscard]]
+        const CVMatrix& cv_matrix() const noexcept { return cv_matrix_; }
+
+    private:
+        template<typename R, typename Proj>
+        void assignImpl(const R& sols, Proj proj);
+
+        ChromosomeMatrix<T> chromosomes_;
+        FitnessMatrix fitness_matrix_;
+        CVMatrix cv_matrix_;
+        size_t size_ = 0;
+        size_t chrom_len_ = 0;
+    };
+
+} // namespace gapp
+
+
+/* IMPLEMENTATION */
+
+namespace gapp
+{
+    template<typename T>
+    template<typename R, typename Proj>
+    void PopulationMatrix<T>::assignImpl(const R& sols, Proj proj)
+    {
+        size_ = sols.size();
+        chrom_len_ = sols.empty() ? 0 : std::invoke(proj, sols[0]).chrom_len();
+
+        const size_t num_obj = sols.empty() ? 0 : std::invoke(proj, sols[0]).num_objectives();
+        const size_t num_cons = sols.empty() ? 0 : std::invoke(proj, sols[0]).num_constraints();
+
+        bool uniform_fitness = (num_obj != 0);
+        bool uniform_cv = (num_cons != 0);
+
+        /* The matrices are refilled instead of recreated to reuse their storage. */
+        chromosomes_.clear();
+        chromosomes_.reserve(size_, chrom_len_);
+
+        for (const auto& elem : sols)
+        {
+            const Candidate<T>& sol = std::invoke(proj, elem);
+
+            GAPP_ASSERT(sol.chrom_len() == chrom_len_, "The chromosomes of the candidates must be the same length.");
+
+            chromosomes_.append_row(sol.chromosome);
+            uniform_fitness = uniform_fitness && (sol.num_objectives() == num_obj);
+            uniform_cv = uniform_cv && (sol.num_constraints() == num_cons);
+        }
+
+        fitness_matrix_.clear();
+        if (uniform_fitness)
+        {
+            fitness_matrix_.reserve(size_, num_obj);
+            for (const auto& elem : sols) fitness_matrix_.append_row(std::invoke(proj, elem).fitness);
+        }
+
+        cv_matrix_.clear();
+        if (uniform_cv)
+        {
+            cv_matrix_.reserve(size_, num_cons);
+            for (const auto& elem : sols) cv_matrix_.append_row(std::invoke(proj, elem).constraint_violation);
+        }
+    }
+
+} // namespace gapp
+
+#endif // !GAPP_CORE_POPULATION_MATRIX_HPP
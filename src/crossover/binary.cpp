@@ -1,6 +1,7 @@
 ﻿/* Copyright (c) 2022 Krisztián Rugási. Subject to the MIT License. */
 
 #include "binary.hpp"
+#include "crossover_base.hpp"
 #include "crossover_impl.hpp"
 #include "../core/candidate.hpp"
 #include "../utility/rng.hpp"
@@ -12,17 +13,17 @@
 
 namespace gapp::crossover::binary
 {
-    auto SinglePoint::crossover(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const -> CandidatePair<GeneType>
+    void SinglePoint::crossover_into(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size(), "Mismatching parent chromosome lengths.");
 
         const size_t chrom_len = parent1.chromosome.size();
         const size_t crossover_point = rng::randomInt(0_sz, chrom_len);
 
-        return dtl::singlePointCrossoverImpl(parent1, parent2, crossover_point);
+        dtl::singlePointCrossoverImpl(parent1, parent2, crossover_point, children);
     }
 
-    auto TwoPoint::crossover(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const -> CandidatePair<GeneType>
+    void TwoPoint::crossover_into(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size(), "Mismatching parent chromosome lengths.");
 
@@ -30,10 +31,10 @@ namespace gapp::crossover::binary
         const size_t crossover_point1 = rng::randomInt(0_sz, chrom_len);
         const size_t crossover_point2 = rng::randomInt(0_sz, chrom_len);
 
-        return dtl::twoPointCrossoverImpl(parent1, parent2, { crossover_point1, crossover_point2 });
+        dtl::twoPointCrossoverImpl(parent1, parent2, { crossover_point1, crossover_point2 }, children);
     }
 
-    auto NPoint::crossover(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const -> CandidatePair<GeneType>
+    void NPoint::crossover_into(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size(), "Mismatching parent chromosome lengths.");
 
@@ -42,10 +43,10 @@ namespace gapp::crossover::binary
 
         auto crossover_points = rng::sampleUnique(0_sz, chrom_len, num_crossover_points);
 
-        return dtl::nPointCrossoverImpl(parent1, parent2, std::move(crossover_points));
+        dtl::nPointCrossoverImpl(parent1, parent2, std::move(crossover_points), children);
     }
 
-    auto Uniform::crossover(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const -> CandidatePair<GeneType>
+    void Uniform::crossover_into(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size(), "Mismatching parent chromosome lengths.");
 
@@ -53,15 +54,15 @@ namespace gapp::crossover::binary
         const size_t num_swapped = rng::randomBinomial(chrom_len, ps_);
         const auto swapped_indices = rng::sampleUnique(0_sz, chrom_len, num_swapped);
 
-        Candidate child1{ parent1 }, child2{ parent2 };
+        auto& [child1, child2] = children;
+        child1 = parent1;
+        child2 = parent2;
 
         for (const auto& idx : swapped_indices)
         {
             using std::swap;
             swap(child1.chromosome[idx], child2.chromosome[idx]);
         }
-
-        return { std::move(child1), std::move(child2) };
     }
 
 } // namespace gapp::crossover::binary
\ No newline at end of file
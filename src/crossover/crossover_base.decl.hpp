@@ -25,10 +25,15 @@ namespace gapp::crossover
     * The crossover operation is only performed on the 2 parents with a set probability only,
     * the rest of the time the returned children will be the same as the parents.
     * 
-    * New crossover operators should be derived from this class, and they must implement the
-    * following virtual method:
+    * New crossover operators should be derived from this class, and they must implement the following
+    * virtual method:
     * 
-    *   - crossover : Perform the crossover on 2 candidate solutions.
+    *   - crossover : Perform the crossover on 2 candidate solutions, returning the children.
+    * 
+    * Crossover operators that can write the children into existing candidates should be derived
+    * from InPlaceCrossover instead.
+    * 
+    * @see InPlaceCrossover
     * 
     * @tparam The gene type the crossover operator is defined for.
     */
@@ -88,6 +93,19 @@ namespace gapp::crossover
         */
         CandidatePair<T> operator()(const GA<T>& ga, const Candidate<T>& parent1, const Candidate<T>& parent2) const;
 
+        /**
+        * Perform the crossover operation on 2 candidate solutions with the set probability,
+        * writing the resulting children into an existing pair of candidates. The storage of
+        * the children's chromosomes is reused if possible.
+        * This function is implemented by crossover_into().
+        *
+        * @param ga The genetic algorithm the crossover operator is being used in.
+        * @param parent1 The first parent solution.
+        * @param parent2 The second parent solution.
+        * @param children The pair of candidates the children will be written into. Must not refer to the parents.
+        */
+        void operator()(const GA<T>& ga, const Candidate<T>& parent1, const Candidate<T>& parent2, CandidatePair<T>& children) const;
+
 
         /** Destructor. */
         virtual ~Crossover()                    = default;
@@ -111,7 +129,7 @@ namespace gapp::crossover
         * 
         * This method will be called once for every 2 children that need to be generated
         * (ie. population_size/2 number of times, rounded up if the population size is odd)
-        * in every generation.
+        * in every generation, unless crossover_into() is overridden.
         * 
         * The implementation of this function must be thread-safe.
         * 
@@ -122,9 +140,64 @@ namespace gapp::crossover
         */
         virtual CandidatePair<T> crossover(const GA<T>& ga, const Candidate<T>& parent1, const Candidate<T>& parent2) const = 0;
 
+        /**
+        * The implementation of the crossover operator that writes the children into an existing
+        * pair of candidates. This is the method used by the GAs, and it can be overridden in addition to
+        * crossover() to avoid allocating new chromosomes for the children in every generation, e.g.
+        * by copy-assigning the parents to the children and modifying the copies.
+        * The default implementation calls crossover() and moves the returned children into @p children.
+        * 
+        * The same requirements apply to this method as to crossover(), and the implementation of
+        * this function must also be thread-safe.
+        * 
+        * @param ga The genetic algorithm the crossover operator is being used in.
+        * @param parent1 The first parent solution.
+        * @param parent2 The second parent solution.
+        * @param children The pair of candidates the children should be written into. Their
+        *   contents are unspecified when the method is called.
+        */
+        virtual void crossover_into(const GA<T>& ga, const Candidate<T>& parent1, const Candidate<T>& parent2, CandidatePair<T>& children) const;
+
         Probability pc_;
     };
 
+    /**
+    * The base class used for the crossover operators that write the children into an existing
+    * pair of candidates, reusing the storage of their chromosomes.
+    * 
+    * New crossover operators derived from this class must implement the following virtual method:
+    * 
+    *   - crossover_into : Perform the crossover on 2 candidate solutions, writing the children into
+    *                      existing candidates.
+    * 
+    * The crossover() method is implemented in terms of crossover_into().
+    * 
+    * @tparam The gene type the crossover operator is defined for.
+    */
+    template<typename T>
+    class InPlaceCrossover : public Crossover<T>
+    {
+    public:
+        using Crossover<T>::Crossover;
+
+    private:
+        CandidatePair<T> crossover(const GA<T>& ga, const Candidate<T>& parent1, const Candidate<T>& parent2) const final;
+
+        /**
+        * The implementation of the crossover operator. Performs the crossover operation
+        * on 2 parent solutions, and writes the resulting child solutions into @p children.
+        * The same requirements apply to this method as to Crossover::crossover(), and the
+        * implementation of this function must also be thread-safe.
+        * 
+        * @param ga The genetic algorithm the crossover operator is being used in.
+        * @param parent1 The first parent solution.
+        * @param parent2 The second parent solution.
+        * @param children The pair of candidates the children should be written into. Their
+        *   contents are unspecified when the method is called.
+        */
+        void crossover_into(const GA<T>& ga, const Candidate<T>& parent1, const Candidate<T>& parent2, CandidatePair<T>& children) const override = 0;
+    };
+
 } // namespace gapp::crossover
 
 #endif // !GA_CROSSOVER_BASE_DECL_HPP
\ No newline at end of file
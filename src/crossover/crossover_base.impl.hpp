@@ -13,17 +13,32 @@ namespace gapp::crossover
 {
     template<typename T>
     CandidatePair<T> Crossover<T>::operator()(const GA<T>& ga, const Candidate<T>& parent1, const Candidate<T>& parent2) const
+    {
+        CandidatePair<T> children;
+        (*this)(ga, parent1, parent2, children);
+
+        return children;
+    }
+
+    template<typename T>
+    void Crossover<T>::operator()(const GA<T>& ga, const Candidate<T>& parent1, const Candidate<T>& parent2, CandidatePair<T>& children) const
     {
         GAPP_ASSERT(parent1.is_evaluated() && parent2.is_evaluated());
         GAPP_ASSERT(parent1.fitness.size() == parent2.fitness.size());
         GAPP_ASSERT(parent1.fitness.size() == ga.num_objectives());
         GAPP_ASSERT(allow_variable_chrom_length() || (parent1.chromosome.size() == ga.chrom_len() &&
                                                       parent2.chromosome.size() == ga.chrom_len()));
+        GAPP_ASSERT(&children.first != &parent1 && &children.first != &parent2);
+        GAPP_ASSERT(&children.second != &parent1 && &children.second != &parent2);
+
+        auto& [child1, child2] = children;
 
         /* Only need to perform the crossover with the set pc probability. Return early with (1 - pc) probability. */
         if (rng::randomReal() >= pc_)
         {
-            return { parent1, parent2 };
+            child1 = parent1;
+            child2 = parent2;
+            return;
         }
 
         /*
@@ -34,11 +49,13 @@ namespace gapp::crossover
         */
         if (parent1 == parent2)
         {
-            return { parent1, parent2 };
+            child1 = parent1;
+            child2 = parent2;
+            return;
         }
 
         /* Perform the actual crossover. */
-        auto [child1, child2] = crossover(ga, parent1, parent2);
+        crossover_into(ga, parent1, parent2, children);
 
         GAPP_ASSERT(allow_variable_chrom_length() || child1.chromosome.size() == ga.chrom_len(),
                   "The crossover returned a candidate with incorrect chromosome length.");
@@ -71,8 +88,21 @@ namespace gapp::crossover
         {
             child2.fitness = parent2.fitness;
         }
+    }
+
+    template<typename T>
+    void Crossover<T>::crossover_into(const GA<T>& ga, const Candidate<T>& parent1, const Candidate<T>& parent2, CandidatePair<T>& children) const
+    {
+        children = crossover(ga, parent1, parent2);
+    }
+
+    template<typename T>
+    CandidatePair<T> InPlaceCrossover<T>::crossover(const GA<T>& ga, const Candidate<T>& parent1, const Candidate<T>& parent2) const
+    {
+        CandidatePair<T> children;
+        crossover_into(ga, parent1, parent2, children);
 
-        return { std::move(child1), std::move(child2) };
+        return children;
     }
 
 } // namespace gapp::crossover
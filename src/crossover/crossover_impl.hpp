@@ -16,42 +16,42 @@ namespace gapp::crossover::dtl
 {
     /* General n-point crossover implementation for any gene type. */
     template<typename T>
-    CandidatePair<T> nPointCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, small_vector<size_t> crossover_points);
+    void nPointCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, small_vector<size_t> crossover_points, CandidatePair<T>& children);
 
     /* Simpler single-point crossover function for any gene type. */
     template<typename T>
-    CandidatePair<T> singlePointCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t crossover_point);
+    void singlePointCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t crossover_point, CandidatePair<T>& children);
 
     /* Simpler two-point crossover function for any gene type. */
     template<typename T>
-    CandidatePair<T> twoPointCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, std::pair<size_t, size_t> crossover_points);
+    void twoPointCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, std::pair<size_t, size_t> crossover_points, CandidatePair<T>& children);
 
 
     /* Implementation of the order-1 crossover for any gene type, only generates a single child. */
     template<typename T>
-    Candidate<T> order1CrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last);
+    void order1CrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last, Candidate<T>& child);
 
     /* Implementation of the order-1 crossover for unsigned integers, only generates a single child. */
     template<std::unsigned_integral T>
-    Candidate<T> order1CrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last);
+    void order1CrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last, Candidate<T>& child);
 
 
     /* Implementation of the order-2 crossover for any gene type, only generates a single child. */
     template<typename T>
-    Candidate<T> order2CrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last);
+    void order2CrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last, Candidate<T>& child);
 
     /* Implementation of the order-2 crossover for unsigned integer genes, only generates a single child. */
     template<std::unsigned_integral T>
-    Candidate<T> order2CrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last);
+    void order2CrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last, Candidate<T>& child);
 
 
     /* Implementation of the position crossover for any gene type, only generates a single child. */
     template<typename T>
-    Candidate<T> positionCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, std::span<const size_t> indices);
+    void positionCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, std::span<const size_t> indices, Candidate<T>& child);
 
     /* Implementation of the position crossover for unsigned integer genes, only generates a single child. */
     template<std::unsigned_integral T>
-    Candidate<T> positionCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, std::span<const size_t> indices);
+    void positionCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, std::span<const size_t> indices, Candidate<T>& child);
 
 
     /* Find the indices of genes in the chromosomes chrom1 and chrom2 which belong to odd cycles. */
@@ -64,25 +64,25 @@ namespace gapp::crossover::dtl
 
     /* Implementation of the cycle crossover for any gene type. */
     template<typename T>
-    CandidatePair<T> cycleCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2);
+    void cycleCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, CandidatePair<T>& children);
 
 
     /* Implementation of the edge crossover for any gene type, only generates a single child. */
     template<typename T>
-    Candidate<T> edgeCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2);
+    void edgeCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, Candidate<T>& child);
 
     /* Implementation of the edge crossover for unsigned integer genes, only generates a single child. */
     template<std::unsigned_integral T>
-    Candidate<T> edgeCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2);
+    void edgeCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, Candidate<T>& child);
 
 
     /* Implementation of the PMX crossover for any gene type, only generates a single child. */
     template<typename T>
-    Candidate<T> pmxCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last);
+    void pmxCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last, Candidate<T>& child);
 
     /* Implementation of the PMX crossover for unsigned integer genes, only generates a single child. */
     template<std::unsigned_integral T>
-    Candidate<T> pmxCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last);
+    void pmxCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last, Candidate<T>& child);
 
 } // namespace gapp::crossover::dtl
 
@@ -98,7 +98,7 @@ namespace gapp::crossover::dtl
 namespace gapp::crossover::dtl
 {
     template<typename T>
-    CandidatePair<T> nPointCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, small_vector<size_t> crossover_points)
+    void nPointCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, small_vector<size_t> crossover_points, CandidatePair<T>& children)
     {
         const size_t chrom_len = parent1.chromosome.size();
 
@@ -108,7 +108,9 @@ namespace gapp::crossover::dtl
         std::sort(crossover_points.begin(), crossover_points.end());
         if (crossover_points.size() % 2) crossover_points.push_back(chrom_len);
 
-        Candidate child1{ parent2 }, child2{ parent1 };
+        auto& [child1, child2] = children;
+        child1 = parent2;
+        child2 = parent1;
 
         for (size_t i = 1; i < crossover_points.size(); i += 2)
         {
@@ -118,29 +120,27 @@ namespace gapp::crossover::dtl
                 swap(child1.chromosome[j], child2.chromosome[j]);
             }
         }
-
-        return { std::move(child1), std::move(child2) };
     }
 
     template<typename T>
-    CandidatePair<T> singlePointCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t crossover_point)
+    void singlePointCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t crossover_point, CandidatePair<T>& children)
     {
         GAPP_ASSERT(crossover_point <= parent1.chromosome.size());
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size());
 
-        Candidate child1{ parent1 }, child2{ parent2 };
+        auto& [child1, child2] = children;
+        child1 = parent1;
+        child2 = parent2;
 
         for (size_t i = 0; i < crossover_point; i++)
         {
             using std::swap;
             swap(child1.chromosome[i], child2.chromosome[i]);
         }
-
-        return { std::move(child1), std::move(child2) };
     }
 
     template<typename T>
-    CandidatePair<T> twoPointCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, std::pair<size_t, size_t> crossover_points)
+    void twoPointCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, std::pair<size_t, size_t> crossover_points, CandidatePair<T>& children)
     {
         GAPP_ASSERT(crossover_points.first <= parent1.chromosome.size());
         GAPP_ASSERT(crossover_points.second <= parent1.chromosome.size());
@@ -151,15 +151,15 @@ namespace gapp::crossover::dtl
             std::swap(crossover_points.first, crossover_points.second);
         }
 
-        Candidate child1{ parent1 }, child2{ parent2 };
+        auto& [child1, child2] = children;
+        child1 = parent1;
+        child2 = parent2;
 
         for (size_t i = crossover_points.first; i < crossover_points.second; i++)
         {
             using std::swap;
             swap(child1.chromosome[i], child2.chromosome[i]);
         }
-
-        return { std::move(child1), std::move(child2) };
     }
 
 
@@ -182,7 +182,7 @@ namespace gapp::crossover::dtl
     }
 
     template<typename T>
-    Candidate<T> order1CrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last)
+    void order1CrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last, Candidate<T>& child)
     {
         const size_t chrom_len = parent1.chromosome.size();
         const size_t range_len = last - first;
@@ -193,7 +193,7 @@ namespace gapp::crossover::dtl
         std::unordered_set<T> direct(last - first);
         for (size_t idx = first; idx != last; idx++) direct.insert(parent1.chromosome[idx]);
 
-        Candidate child = parent1;
+        child = parent1;
 
         size_t parent_pos = (last == chrom_len) ? 0 : last;
         size_t child_pos = (last == chrom_len) ? 0 : last;
@@ -207,12 +207,10 @@ namespace gapp::crossover::dtl
             detail::increment_mod(parent_pos, chrom_len);
             detail::increment_mod(child_pos, chrom_len);
         }
-
-        return child;
     }
 
     template<std::unsigned_integral T>
-    Candidate<T> order1CrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last)
+    void order1CrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last, Candidate<T>& child)
     {
         const size_t chrom_len = parent1.chromosome.size();
         const size_t range_len = last - first;
@@ -225,7 +223,7 @@ namespace gapp::crossover::dtl
         detail::dynamic_bitset is_direct(chrom_len);
         for (size_t idx = first; idx != last; idx++) is_direct[parent1.chromosome[idx]] = true;
 
-        Candidate child = parent1;
+        child = parent1;
 
         size_t parent_pos = (last == chrom_len) ? 0 : last;
         size_t child_pos  = (last == chrom_len) ? 0 : last;
@@ -239,13 +237,11 @@ namespace gapp::crossover::dtl
             detail::increment_mod(parent_pos, chrom_len);
             detail::increment_mod(child_pos, chrom_len);
         }
-
-        return child;
     }
 
 
     template<typename T>
-    Candidate<T> order2CrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last)
+    void order2CrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last, Candidate<T>& child)
     {
         GAPP_ASSERT(first <= last && last <= parent1.chromosome.size());
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size());
@@ -253,7 +249,7 @@ namespace gapp::crossover::dtl
         std::unordered_set<T> direct(last - first);
         for (size_t idx = first; idx != last; idx++) direct.insert(parent1.chromosome[idx]);
 
-        Candidate child = parent1;
+        child = parent1;
 
         for (size_t child_pos = 0; const T& gene : parent2.chromosome)
         {
@@ -263,12 +259,10 @@ namespace gapp::crossover::dtl
                 child.chromosome[child_pos++] = gene;
             }
         }
-
-        return child;
     }
 
     template<std::unsigned_integral T>
-    Candidate<T> order2CrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last)
+    void order2CrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last, Candidate<T>& child)
     {
         const size_t chrom_len = parent1.chromosome.size();
 
@@ -280,7 +274,7 @@ namespace gapp::crossover::dtl
         detail::dynamic_bitset is_direct(chrom_len);
         for (size_t idx = first; idx != last; idx++) is_direct[parent1.chromosome[idx]] = true;
 
-        Candidate child = parent1;
+        child = parent1;
 
         for (size_t child_pos = 0; const T& gene : parent2.chromosome)
         {
@@ -290,13 +284,11 @@ namespace gapp::crossover::dtl
                 child.chromosome[child_pos++] = gene;
             }
         }
-
-        return child;
     }
 
 
     template<typename T>
-    Candidate<T> positionCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, std::span<const size_t> indices)
+    void positionCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, std::span<const size_t> indices, Candidate<T>& child)
     {
         GAPP_ASSERT(std::all_of(indices.begin(), indices.end(), detail::between(0_sz, parent1.chromosome.size() - 1)));
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size());
@@ -304,7 +296,7 @@ namespace gapp::crossover::dtl
         std::unordered_set<T> direct(indices.size());
         for (size_t idx : indices) direct.insert(parent1.chromosome[idx]);
 
-        Candidate child = parent1;
+        child = parent1;
 
         for (auto child_pos = child.chromosome.begin(); const T& gene : parent2.chromosome)
         {
@@ -314,12 +306,10 @@ namespace gapp::crossover::dtl
                 *child_pos++ = gene;
             }
         }
-
-        return child;
     }
 
     template<std::unsigned_integral T>
-    Candidate<T> positionCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, std::span<const size_t> indices)
+    void positionCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, std::span<const size_t> indices, Candidate<T>& child)
     {
         const size_t chrom_len = parent1.chromosome.size();
         
@@ -340,7 +330,7 @@ namespace gapp::crossover::dtl
             next_indirect[i] = indirect;
         }
 
-        Candidate child = parent1;
+        child = parent1;
 
         for (size_t child_pos = 0; T gene : parent2.chromosome)
         {
@@ -350,8 +340,6 @@ namespace gapp::crossover::dtl
                 child.chromosome[child_pos++] = gene;
             }
         }
-
-        return child;
     }
 
 
@@ -438,27 +426,26 @@ namespace gapp::crossover::dtl
     }
 
     template<typename T>
-    CandidatePair<T> cycleCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2)
+    void cycleCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, CandidatePair<T>& children)
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size());
 
         const auto odd_cycle_idxs = dtl::findOddCycleIndices(parent1.chromosome, parent2.chromosome);
 
-        Candidate child1 = parent1;
-        Candidate child2 = parent2;
+        auto& [child1, child2] = children;
+        child1 = parent1;
+        child2 = parent2;
 
         for (size_t idx : odd_cycle_idxs)
         {
             using std::swap;
             swap(child1.chromosome[idx], child2.chromosome[idx]);
         }
-
-        return { std::move(child1), std::move(child2) };
     }
 
 
     template<typename T>
-    Candidate<T> edgeCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2)
+    void edgeCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, Candidate<T>& child)
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size());
 
@@ -466,8 +453,8 @@ namespace gapp::crossover::dtl
 
         auto nb_lists = makeNeighbourLists(parent1.chromosome, parent2.chromosome);
 
-        Candidate<T> child{ parent1.chromosome[0] };
-        child.chromosome.reserve(chrom_len);
+        child = parent1;
+        child.chromosome.resize(1);
 
         std::vector<T> remaining_genes(parent1.chromosome.begin() + 1, parent1.chromosome.end());
 
@@ -489,12 +476,10 @@ namespace gapp::crossover::dtl
             child.chromosome.push_back(next_gene);
             std::erase(remaining_genes, next_gene);
         }
-
-        return child;
     }
 
     template<std::unsigned_integral T>
-    Candidate<T> edgeCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2)
+    void edgeCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, Candidate<T>& child)
     {
         const size_t chrom_len = parent1.chromosome.size();
 
@@ -504,8 +489,8 @@ namespace gapp::crossover::dtl
 
         auto nb_lists = makeNeighbourLists(parent1.chromosome, parent2.chromosome);
 
-        Candidate<T> child{ parent1.chromosome[0] };
-        child.chromosome.reserve(chrom_len);
+        child = parent1;
+        child.chromosome.resize(1);
 
         detail::dynamic_bitset is_used(chrom_len);
         is_used[parent1.chromosome[0]] = true;
@@ -530,18 +515,16 @@ namespace gapp::crossover::dtl
             child.chromosome.push_back(next_gene);
             is_used[next_gene] = true;
         }
-
-        return child;
     }
 
 
     template<typename T>
-    Candidate<T> pmxCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last)
+    void pmxCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last, Candidate<T>& child)
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size());
         GAPP_ASSERT(first <= last && last <= parent1.chromosome.size());
 
-        Candidate child = parent2;
+        child = parent2;
 
         std::unordered_set<T> direct(last - first);
         for (size_t i = first; i < last; i++)
@@ -562,12 +545,10 @@ namespace gapp::crossover::dtl
                 child.chromosome[pos] = parent2.chromosome[i];
             }
         }
-
-        return child;
     }
 
     template<std::unsigned_integral T>
-    Candidate<T> pmxCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last)
+    void pmxCrossoverImpl(const Candidate<T>& parent1, const Candidate<T>& parent2, size_t first, size_t last, Candidate<T>& child)
     {
         const size_t chrom_len = parent1.chromosome.size();
 
@@ -576,7 +557,7 @@ namespace gapp::crossover::dtl
         GAPP_ASSERT(isValidIntegerPermutation(parent1.chromosome));
         GAPP_ASSERT(isValidIntegerPermutation(parent2.chromosome));
 
-        Candidate child = parent2;
+        child = parent2;
 
         detail::dynamic_bitset is_direct(chrom_len);
         for (size_t i = first; i < last; i++)
@@ -603,8 +584,6 @@ namespace gapp::crossover::dtl
                 child.chromosome[pos] = parent2.chromosome[i];
             }
         }
-
-        return child;
     }
     
 } // namespace gapp::crossover::dtl
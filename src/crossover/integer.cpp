@@ -14,26 +14,26 @@
 
 namespace gapp::crossover::integer
 {
-    auto SinglePoint::crossover(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const -> CandidatePair<GeneType>
+    void SinglePoint::crossover_into(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size(), "Mismatching parent chromosome lengths.");
 
         const size_t chrom_len = parent1.chromosome.size();
         const size_t crossover_point = rng::randomInt(0_sz, chrom_len);
 
-        return dtl::singlePointCrossoverImpl(parent1, parent2, crossover_point);
+        dtl::singlePointCrossoverImpl(parent1, parent2, crossover_point, children);
     }
 
-    auto TwoPoint::crossover(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const -> CandidatePair<GeneType>
+    void TwoPoint::crossover_into(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size(), "Mismatching parent chromosome lengths.");
 
         const size_t chrom_len = parent1.chromosome.size();
 
-        return dtl::twoPointCrossoverImpl(parent1, parent2, { rng::randomInt(0_sz, chrom_len), rng::randomInt(0_sz, chrom_len) });
+        dtl::twoPointCrossoverImpl(parent1, parent2, { rng::randomInt(0_sz, chrom_len), rng::randomInt(0_sz, chrom_len) }, children);
     }
 
-    auto NPoint::crossover(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const -> CandidatePair<GeneType>
+    void NPoint::crossover_into(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size(), "Mismatching parent chromosome lengths.");
 
@@ -42,10 +42,10 @@ namespace gapp::crossover::integer
 
         auto cx_points = rng::sampleUnique(0_sz, chrom_len, num_cx_points);
 
-        return dtl::nPointCrossoverImpl(parent1, parent2, std::move(cx_points));
+        dtl::nPointCrossoverImpl(parent1, parent2, std::move(cx_points), children);
     }
 
-    auto Uniform::crossover(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const -> CandidatePair<GeneType>
+    void Uniform::crossover_into(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size(), "Mismatching parent chromosome lengths.");
         
@@ -53,16 +53,15 @@ namespace gapp::crossover::integer
         const size_t num_swapped = rng::randomBinomial(chrom_len, ps_);
         const auto swapped_indices = rng::sampleUnique(0_sz, chrom_len, num_swapped);
 
-        Candidate child1 = parent1;
-        Candidate child2 = parent2;
+        auto& [child1, child2] = children;
+        child1 = parent1;
+        child2 = parent2;
 
         for (const auto& idx : swapped_indices)
         {
             using std::swap;
             swap(child1.chromosome[idx], child2.chromosome[idx]);
         }
-
-        return { std::move(child1), std::move(child2) };
     }
 
 } // namespace gapp::crossover::integer
\ No newline at end of file
@@ -19,12 +19,12 @@ namespace gapp::crossover::integer
     * and the genes before this crossover point are swapped between the parents
     * in order to create the child solutions.
     */
-    class SinglePoint final : public Crossover<IntegerGene>
+    class SinglePoint final : public InPlaceCrossover<IntegerGene>
     {
     public:
-        using Crossover::Crossover;
+        using InPlaceCrossover::InPlaceCrossover;
     private:
-        CandidatePair<GeneType> crossover(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const override;
+        void crossover_into(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const override;
     };
 
     /**
@@ -36,12 +36,12 @@ namespace gapp::crossover::integer
     * This operation is effectively the same as performing 2 consecutive single-point
     * crossovers on the parents.
     */
-    class TwoPoint final : public Crossover<IntegerGene>
+    class TwoPoint final : public InPlaceCrossover<IntegerGene>
     {
     public:
-        using Crossover::Crossover;
+        using InPlaceCrossover::InPlaceCrossover;
     private:
-        CandidatePair<GeneType> crossover(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const override;
+        void crossover_into(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const override;
     };
 
     /**
@@ -52,7 +52,7 @@ namespace gapp::crossover::integer
     * This operation is effectively the same as performing N consecutive single-point
     * crossovers on the parents to generate the child solutions.
     */
-    class NPoint final : public Crossover<IntegerGene>
+    class NPoint final : public InPlaceCrossover<IntegerGene>
     {
     public:
         /**
@@ -71,7 +71,7 @@ namespace gapp::crossover::integer
         * @param n The number of crossover points. Must be at least 1.
         */
         constexpr NPoint(Probability pc, Positive<size_t> n) noexcept :
-            Crossover(pc), n_(n)
+            InPlaceCrossover(pc), n_(n)
         {}
 
         /**
@@ -88,7 +88,7 @@ namespace gapp::crossover::integer
         constexpr size_t num_crossover_points() const noexcept { return n_; };
 
     private:
-        CandidatePair<GeneType> crossover(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const override;
+        void crossover_into(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const override;
 
         Positive<size_t> n_;
     };
@@ -99,7 +99,7 @@ namespace gapp::crossover::integer
     * Each pair of genes of the chromosomes are swapped with a set probability
     * between the parents to create the child solutions.
     */
-    class Uniform final : public Crossover<IntegerGene>
+    class Uniform final : public InPlaceCrossover<IntegerGene>
     {
     public:
         /** Create a uniform crossover operator using the default crossover and swap rates. */
@@ -113,7 +113,7 @@ namespace gapp::crossover::integer
         *   Must be in the closed interval [0.0, 1.0].
         */
         constexpr explicit Uniform(Probability pc, Probability ps = 0.5) noexcept :
-            Crossover(pc), ps_(ps)
+            InPlaceCrossover(pc), ps_(ps)
         {}
 
         /**
@@ -131,7 +131,7 @@ namespace gapp::crossover::integer
         constexpr Probability swap_probability() const noexcept { return ps_; }
 
     private:
-        CandidatePair<GeneType> crossover(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const override;
+        void crossover_into(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const override;
 
         Probability ps_ = 0.5;
     };
@@ -12,101 +12,121 @@
 
 namespace gapp::crossover::perm
 {
-    auto Order1::crossover(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const -> CandidatePair<GeneType>
+    void Order1::crossover_into(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size(), "Mismatching parent chromosome lengths.");
 
         const size_t chrom_len = parent1.chromosome.size();
 
-        if (chrom_len < 2) return { parent1, parent2 };
+        if (chrom_len < 2)
+        {
+            children.first = parent1;
+            children.second = parent2;
+            return;
+        }
 
         const size_t length = rng::randomInt(1_sz, chrom_len - 1_sz);
         const size_t first = rng::randomInt(0_sz, chrom_len - length);
         const size_t last = first + length;
 
-        auto child1 = dtl::order1CrossoverImpl(parent1, parent2, first, last);
-        auto child2 = dtl::order1CrossoverImpl(parent2, parent1, first, last);
-
-        return { std::move(child1), std::move(child2) };
+        dtl::order1CrossoverImpl(parent1, parent2, first, last, children.first);
+        dtl::order1CrossoverImpl(parent2, parent1, first, last, children.second);
     }
 
-    auto Order2::crossover(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const -> CandidatePair<GeneType>
+    void Order2::crossover_into(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size(), "Mismatching parent chromosome lengths.");
 
         const size_t chrom_len = parent1.chromosome.size();
 
-        if (chrom_len < 2) return { parent1, parent2 };
+        if (chrom_len < 2)
+        {
+            children.first = parent1;
+            children.second = parent2;
+            return;
+        }
 
         const size_t length = rng::randomInt(1_sz, chrom_len - 1_sz);
         const size_t first = rng::randomInt(0_sz, chrom_len - length);
         const size_t last = first + length;
 
-        auto child1 = dtl::order2CrossoverImpl(parent1, parent2, first, last);
-        auto child2 = dtl::order2CrossoverImpl(parent2, parent1, first, last);
-
-        return { std::move(child1), std::move(child2) };
+        dtl::order2CrossoverImpl(parent1, parent2, first, last, children.first);
+        dtl::order2CrossoverImpl(parent2, parent1, first, last, children.second);
     }
 
-    auto Position::crossover(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const -> CandidatePair<GeneType>
+    void Position::crossover_into(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size(), "Mismatching parent chromosome lengths.");
 
         const size_t chrom_len = parent1.chromosome.size();
 
-        if (chrom_len < 2) return { parent1, parent2 };
+        if (chrom_len < 2)
+        {
+            children.first = parent1;
+            children.second = parent2;
+            return;
+        }
 
         const size_t ns = rng::randomInt(1_sz, chrom_len - 1_sz);
         const auto idxs = rng::sampleUnique(0_sz, chrom_len, ns);
 
-        auto child1 = dtl::positionCrossoverImpl(parent1, parent2, idxs);
-        auto child2 = dtl::positionCrossoverImpl(parent2, parent1, idxs);
-
-        return { std::move(child1), std::move(child2) };
+        dtl::positionCrossoverImpl(parent1, parent2, idxs, children.first);
+        dtl::positionCrossoverImpl(parent2, parent1, idxs, children.second);
     }
 
-    auto Cycle::crossover(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const -> CandidatePair<GeneType>
+    void Cycle::crossover_into(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size(), "Mismatching parent chromosome lengths.");
 
         const size_t chrom_len = parent1.chromosome.size();
 
-        if (chrom_len < 2) return { parent1, parent2 };
+        if (chrom_len < 2)
+        {
+            children.first = parent1;
+            children.second = parent2;
+            return;
+        }
 
-        return dtl::cycleCrossoverImpl(parent1, parent2);
+        dtl::cycleCrossoverImpl(parent1, parent2, children);
     }
 
-    auto Edge::crossover(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const -> CandidatePair<GeneType>
+    void Edge::crossover_into(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size(), "Mismatching parent chromosome lengths.");
 
         const size_t chrom_len = parent1.chromosome.size();
 
-        if (chrom_len < 2) return { parent1, parent2 };
+        if (chrom_len < 2)
+        {
+            children.first = parent1;
+            children.second = parent2;
+            return;
+        }
 
-        auto child1 = dtl::edgeCrossoverImpl(parent1, parent2);
-        auto child2 = dtl::edgeCrossoverImpl(parent2, parent1);
-
-        return { std::move(child1), std::move(child2) };
+        dtl::edgeCrossoverImpl(parent1, parent2, children.first);
+        dtl::edgeCrossoverImpl(parent2, parent1, children.second);
     }
 
-    auto PMX::crossover(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const -> CandidatePair<GeneType>
+    void PMX::crossover_into(const GA<GeneType>&, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size(), "Mismatching parent chromosome lengths.");
 
         const size_t chrom_len = parent1.chromosome.size();
         
-        if (chrom_len < 2) return { parent1, parent2 };
+        if (chrom_len < 2)
+        {
+            children.first = parent1;
+            children.second = parent2;
+            return;
+        }
 
         const size_t range_len = rng::randomInt(1_sz, chrom_len - 1);
 
         const size_t first = rng::randomInt(0_sz, chrom_len - range_len);
         const size_t last = first + range_len;
 
-        auto child1 = dtl::pmxCrossoverImpl(parent1, parent2, first, last);
-        auto child2 = dtl::pmxCrossoverImpl(parent2, parent1, first, last);
-
-        return { std::move(child1), std::move(child2) };
+        dtl::pmxCrossoverImpl(parent1, parent2, first, last, children.first);
+        dtl::pmxCrossoverImpl(parent2, parent1, first, last, children.second);
     }
 
 } // namespace gapp::crossover::perm
\ No newline at end of file
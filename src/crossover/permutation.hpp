@@ -20,12 +20,12 @@ namespace gapp::crossover::perm
     * The second child is created by repeating this process with the roles of the two parents swapped.
     * The same range of genes is used for the directly copied genes.
     */
-    class Order1 final : public Crossover<PermutationGene>
+    class Order1 final : public InPlaceCrossover<PermutationGene>
     {
     public:
-        using Crossover::Crossover;
+        using InPlaceCrossover::InPlaceCrossover;
     private:
-        CandidatePair<GeneType> crossover(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const override;
+        void crossover_into(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const override;
     };
 
     /**
@@ -39,12 +39,12 @@ namespace gapp::crossover::perm
     * The second child is created by repeating this process with the roles of the two parents swapped.
     * The same range of genes is used for the directly copied genes.
     */
-    class Order2 final : public Crossover<PermutationGene>
+    class Order2 final : public InPlaceCrossover<PermutationGene>
     {
     public:
-        using Crossover::Crossover;
+        using InPlaceCrossover::InPlaceCrossover;
     private:
-        CandidatePair<GeneType> crossover(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const override;
+        void crossover_into(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const override;
     };
 
     /**
@@ -59,12 +59,12 @@ namespace gapp::crossover::perm
     * The second child is created by repeating this process with the roles of the two parents swapped,
     * but using the same positions for direct copying that were used to create the first child.
     */
-    class Position final : public Crossover<PermutationGene>
+    class Position final : public InPlaceCrossover<PermutationGene>
     {
     public:
-        using Crossover::Crossover;
+        using InPlaceCrossover::InPlaceCrossover;
     private:
-        CandidatePair<GeneType> crossover(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const override;
+        void crossover_into(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const override;
     };
 
     /**
@@ -74,12 +74,12 @@ namespace gapp::crossover::perm
     * and building the 2 child solutions from these cycles.
     * Each of the genes in the children appears in the same position in one of the parents.
     */
-    class Cycle final : public Crossover<PermutationGene>
+    class Cycle final : public InPlaceCrossover<PermutationGene>
     {
     public:
-        using Crossover::Crossover;
+        using InPlaceCrossover::InPlaceCrossover;
     private:
-        CandidatePair<GeneType> crossover(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const override;
+        void crossover_into(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const override;
     };
 
     /**
@@ -90,12 +90,12 @@ namespace gapp::crossover::perm
     * This crossover operator is significantly slower than the other implemented operators,
     * but produces good results.
     */
-    class Edge final : public Crossover<PermutationGene>
+    class Edge final : public InPlaceCrossover<PermutationGene>
     {
     public:
-        using Crossover::Crossover;
+        using InPlaceCrossover::InPlaceCrossover;
     private:
-        CandidatePair<GeneType> crossover(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const override;
+        void crossover_into(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const override;
     };
 
     /**
@@ -108,12 +108,12 @@ namespace gapp::crossover::perm
     * 
     * The second child is created by performing the same process with the roles of the 2 parents swapped.
     */
-    class PMX final : public Crossover<PermutationGene>
+    class PMX final : public InPlaceCrossover<PermutationGene>
     {
     public:
-        using Crossover::Crossover;
+        using InPlaceCrossover::InPlaceCrossover;
     private:
-        CandidatePair<GeneType> crossover(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const override;
+        void crossover_into(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const override;
     };
 
 } // namespace gapp::crossover::perm
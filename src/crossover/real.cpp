@@ -17,7 +17,7 @@
 
 namespace gapp::crossover::real
 {
-    auto Arithmetic::crossover(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const -> CandidatePair<GeneType>
+    void Arithmetic::crossover_into(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size(), "Mismatching parent chromosome lengths.");
         GAPP_ASSERT(ga.gene_bounds().size() == parent1.chromosome.size(), "Mismatching bounds and chromosome lengths.");
@@ -25,7 +25,9 @@ namespace gapp::crossover::real
         const auto& bounds = ga.gene_bounds();
         const size_t chrom_len = parent1.chromosome.size();
 
-        Candidate child1{ parent1 }, child2{ parent2 };
+        auto& [child1, child2] = children;
+        child1 = parent1;
+        child2 = parent2;
 
         const GeneType alpha = rng::randomReal();
         for (size_t i = 0; i < chrom_len; i++)
@@ -37,11 +39,9 @@ namespace gapp::crossover::real
             child1.chromosome[i] = std::clamp(child1.chromosome[i], bounds[i].lower(), bounds[i].upper());
             child2.chromosome[i] = std::clamp(child2.chromosome[i], bounds[i].lower(), bounds[i].upper());
         }
-
-        return { std::move(child1), std::move(child2) };
     }
 
-    auto BLXa::crossover(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const -> CandidatePair<GeneType>
+    void BLXa::crossover_into(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size(), "Mismatching parent chromosome lengths.");
         GAPP_ASSERT(ga.gene_bounds().size() == parent1.chromosome.size(), "Mismatching bounds and chromosome lengths.");
@@ -49,7 +49,9 @@ namespace gapp::crossover::real
         const auto& bounds = ga.gene_bounds();
         const size_t chrom_len = parent1.chromosome.size();
 
-        Candidate child1{ parent1 }, child2{ parent2 };
+        auto& [child1, child2] = children;
+        child1 = parent1;
+        child2 = parent2;
 
         for (size_t i = 0; i < chrom_len; i++)
         {
@@ -63,11 +65,9 @@ namespace gapp::crossover::real
             child1.chromosome[i] = std::clamp(child1.chromosome[i], bounds[i].lower(), bounds[i].upper());
             child2.chromosome[i] = std::clamp(child2.chromosome[i], bounds[i].lower(), bounds[i].upper());
         }
-
-        return { std::move(child1), std::move(child2) };
     }
 
-    auto SimulatedBinary::crossover(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const -> CandidatePair<GeneType>
+    void SimulatedBinary::crossover_into(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size(), "Mismatching parent chromosome lengths.");
         GAPP_ASSERT(ga.gene_bounds().size() == parent1.chromosome.size(), "Mismatching bounds and chromosome lengths.");
@@ -75,7 +75,9 @@ namespace gapp::crossover::real
         const auto& bounds = ga.gene_bounds();
         const size_t chrom_len = parent1.chromosome.size();
 
-        Candidate child1{ parent1 }, child2{ parent2 };
+        auto& [child1, child2] = children;
+        child1 = parent1;
+        child2 = parent2;
 
         for (size_t i = 0; i < chrom_len; i++)
         {
@@ -108,11 +110,9 @@ namespace gapp::crossover::real
             child1.chromosome[i] = std::clamp(child1.chromosome[i], bounds[i].lower(), bounds[i].upper());
             child2.chromosome[i] = std::clamp(child2.chromosome[i], bounds[i].lower(), bounds[i].upper());
         }
-
-        return { std::move(child1), std::move(child2) };
     }
 
-    auto Wright::crossover(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const -> CandidatePair<GeneType>
+    void Wright::crossover_into(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const
     {
         GAPP_ASSERT(parent1.chromosome.size() == parent2.chromosome.size(), "Mismatching parent chromosome lengths.");
         GAPP_ASSERT(ga.gene_bounds().size() == parent1.chromosome.size(), "Mismatching bounds and chromosome lengths.");
@@ -121,7 +121,9 @@ namespace gapp::crossover::real
         const auto& bounds = ga.gene_bounds();
         const size_t chrom_len = parent1.chromosome.size();
 
-        Candidate child1{ parent1 }, child2{ parent2 };
+        auto& [child1, child2] = children;
+        child1 = parent1;
+        child2 = parent2;
 
         /* p1 is always the better parent. */
         const auto& p1 = math::paretoCompareLess(parent1.fitness, parent2.fitness) ? parent2 : parent1;
@@ -138,8 +140,6 @@ namespace gapp::crossover::real
             child1.chromosome[i] = std::clamp(child1.chromosome[i], bounds[i].lower(), bounds[i].upper());
             child2.chromosome[i] = std::clamp(child2.chromosome[i], bounds[i].lower(), bounds[i].upper());
         }
-
-        return { std::move(child1), std::move(child2) };
     }
 
 } // namespace gapp::crossover::real
\ No newline at end of file
@@ -20,12 +20,12 @@ namespace gapp::crossover::real
     * where \f$ \beta \f$ is a random number generated from a uniform distribution on [0.0, 1.0].
     * The same \f$ \beta \f$ value is used for each pair of parent genes.
     */
-    class Arithmetic final : public Crossover<RealGene>
+    class Arithmetic final : public InPlaceCrossover<RealGene>
     {
     public:
-        using Crossover::Crossover;
+        using InPlaceCrossover::InPlaceCrossover;
     private:
-        CandidatePair<GeneType> crossover(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const override;
+        void crossover_into(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const override;
     };
 
     /**
@@ -42,7 +42,7 @@ namespace gapp::crossover::real
     * of the intervals the child genes are chosen from. Larger alpha values correspond to 
     * larger intervals. The recommended value of alpha is around 0.5.
     */
-    class BLXa final : public Crossover<RealGene>
+    class BLXa final : public InPlaceCrossover<RealGene>
     {
     public:
         /** Create a BLX-alpha crossover operator. */
@@ -57,7 +57,7 @@ namespace gapp::crossover::real
         * @param alpha The alpha parameter of the crossover. Must be a finite non-negative value.
         */
         constexpr explicit BLXa(Probability pc, NonNegative<GeneType> alpha = 0.5) noexcept :
-            Crossover(pc), alpha_(alpha)
+            InPlaceCrossover(pc), alpha_(alpha)
         {}
 
         /**
@@ -74,7 +74,7 @@ namespace gapp::crossover::real
         constexpr GeneType alpha() const noexcept { return alpha_; }
 
     private:
-        CandidatePair<GeneType> crossover(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const override;
+        void crossover_into(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const override;
 
         NonNegative<GeneType> alpha_;
     };
@@ -88,7 +88,7 @@ namespace gapp::crossover::real
     * from the parents, while smaller values will result in the children being closer to the parents.
     * Typical values for eta are in the range [1.0, 5.0].
     */
-    class SimulatedBinary final : public Crossover<RealGene>
+    class SimulatedBinary final : public InPlaceCrossover<RealGene>
     {
     public:
         /** Create a simulated binary crossover operator. */
@@ -104,7 +104,7 @@ namespace gapp::crossover::real
         *   Must be finite, non-negative value.
         */
         constexpr explicit SimulatedBinary(Probability pc, NonNegative<GeneType> eta = 4.0) noexcept :
-            Crossover(pc), eta_(eta)
+            InPlaceCrossover(pc), eta_(eta)
         {}
 
         /**
@@ -124,7 +124,7 @@ namespace gapp::crossover::real
         constexpr GeneType eta() const noexcept { return eta_; }
 
     private:
-        CandidatePair<GeneType> crossover(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const override;
+        void crossover_into(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const override;
 
         NonNegative<GeneType> eta_;
     };
@@ -138,12 +138,12 @@ namespace gapp::crossover::real
     * where \f$ w_1 \f$ and \f$ w_2 \f$ are random weights generated from a uniform
     * distribution on [0.0, 1.0]. The same weights are used for all of the genes.
     */
-    class Wright final : public Crossover<RealGene>
+    class Wright final : public InPlaceCrossover<RealGene>
     {
     public:
-        using Crossover::Crossover;
+        using InPlaceCrossover::InPlaceCrossover;
     private:
-        CandidatePair<GeneType> crossover(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2) const override;
+        void crossover_into(const GA<GeneType>& ga, const Candidate<GeneType>& parent1, const Candidate<GeneType>& parent2, CandidatePair<GeneType>& children) const override;
     };
 
 
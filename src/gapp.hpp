@@ -6,9 +6,11 @@
 #include "utility/rng.hpp"
 #include "core/candidate.hpp"
 #include "core/population.hpp"
+#include "core/population_matrix.hpp"
 #include "core/fitness_function.hpp"
 #include "core/ga_info.hpp"
 #include "core/ga_base.hpp"
+#include "core/island_model.hpp"
 #include "encoding/encoding.hpp"
 #include "algorithm/algorithm.hpp"
 #include "crossover/crossover.hpp"
@@ -25,8 +25,24 @@ namespace gapp::metrics
     }
 
 
-    Hypervolume::Hypervolume(FitnessVector ref_point) noexcept :
-        ref_point_(std::move(ref_point))
+    static double computeHypervolume(HypervolumeMethod method, double max_error, detail::IncrementalHypervolume& incremental_hypervolume,
+                                     const FitnessMatrix& fitness_matrix, std::span<const double> ref_point)
+    {
+        switch (method)
+        {
+            case HypervolumeMethod::Exact:
+                return detail::hypervolume(fitness_matrix, ref_point);
+            case HypervolumeMethod::Incremental:
+                return incremental_hypervolume.update(fitness_matrix, ref_point);
+            case HypervolumeMethod::Approximate:
+                return detail::hypervolumeApprox(fitness_matrix, ref_point, max_error);
+        }
+        GAPP_UNREACHABLE();
+    }
+
+
+    Hypervolume::Hypervolume(FitnessVector ref_point, HypervolumeMethod method, Positive<double> max_error) noexcept :
+        ref_point_(std::move(ref_point)), method_(method), max_error_(max_error)
     {}
 
     void Hypervolume::initialize(const GaInfo& ga)
@@ -35,6 +51,8 @@ namespace gapp::metrics
 
         data_.clear();
         data_.reserve(ga.max_gen());
+
+        incremental_hypervolume_.reset();
     }
 
     void Hypervolume::update(const GaInfo& ga)
@@ -42,10 +60,15 @@ namespace gapp::metrics
         GAPP_ASSERT(ref_point_.size() == ga.num_objectives());
 
         const auto& fitness_matrix = ga.fitness_matrix();
-        data_.push_back(detail::hypervolume(fitness_matrix, ref_point_));
+        data_.push_back(computeHypervolume(method_, max_error_, incremental_hypervolume_, fitness_matrix, ref_point_));
     }
 
 
+    AutoHypervolume::AutoHypervolume(HypervolumeMethod method, Positive<double> max_error) noexcept :
+        method_(method), max_error_(max_error)
+    {}
+
+
     void AutoHypervolume::initialize(const GaInfo& ga)
     {
         data_.clear();
@@ -55,6 +78,7 @@ namespace gapp::metrics
         ideal_points_.reserve(ga.max_gen(), ga.num_objectives());
 
         worst_point_ = FitnessVector(ga.num_objectives(), math::inf<double>);
+        incremental_hypervolume_.reset();
     }
 
     void AutoHypervolume::update(const GaInfo& ga)
@@ -78,7 +102,7 @@ namespace gapp::metrics
             }
         }
 
-        data_.push_back(detail::hypervolume(fitness_matrix, worst_point_));
+        data_.push_back(computeHypervolume(method_, max_error_, incremental_hypervolume_, fitness_matrix, worst_point_));
         ideal_points_.append_row(std::move(ideal_point));
     }
 
@@ -4,7 +4,9 @@
 #define GA_METRICS_DISTRIBUTION_METRICS_HPP
 
 #include "monitor.hpp"
+#include "pop_stats.hpp"
 #include "../core/candidate.hpp"
+#include "../utility/bounded_value.hpp"
 #include <span>
 
 namespace gapp::metrics
@@ -20,6 +22,14 @@ namespace gapp::metrics
         void update(const GaInfo& ga) override;
     };
 
+    /** The methods that can be used for computing the hypervolumes in the Hypervolume and AutoHypervolume metrics. */
+    enum class HypervolumeMethod
+    {
+        Exact,          /**< Compute the exact hypervolume of the population in every generation. */
+        Incremental,    /**< Compute the exact hypervolume by updating the previous generation's hypervolume based on the changes in the pareto front. */
+        Approximate,    /**< Estimate the hypervolume using quasi-Monte Carlo sampling. */
+    };
+
     /**
     * Record the hypervolume of the population's fitness values in each generation
     * relative to some reference point. The coordinates of this reference point should be
@@ -29,7 +39,10 @@ namespace gapp::metrics
     * This metric is intended for multi-objective problems, but it also works for
     * single-objective ones.
     * 
-    * @note This metric can be computationally expensive for large populations and dimensions.
+    * @note This metric can be computationally expensive for large populations and dimensions
+    *   when the exact hypervolumes are computed. The incremental method is faster when only a few
+    *   points of the pareto front change between generations, while the approximate method should
+    *   be used for problems with many objectives.
     */
     class Hypervolume final : public Monitor<Hypervolume, std::vector<double>>
     {
@@ -41,17 +54,29 @@ namespace gapp::metrics
         *   The size of this point should match the number of objectives of the fitness functions,
         *   and it should be dominated by every point in the objective space that it will be
         *   compared to.
+        * @param method The method used to compute the hypervolumes.
+        * @param max_error The maximum relative error of the hypervolumes computed using the
+        *   approximate method. Not used by the other methods.
         */
-        explicit Hypervolume(FitnessVector ref_point) noexcept;
+        explicit Hypervolume(FitnessVector ref_point, HypervolumeMethod method = HypervolumeMethod::Exact, Positive<double> max_error = 0.01) noexcept;
 
         /** @returns The reference point used for computing the hypervolumes. */
         const FitnessVector& ref_point() const noexcept { return ref_point_; }
 
+        /** @returns The method used for computing the hypervolumes. */
+        HypervolumeMethod method() const noexcept { return method_; }
+
+        /** @returns The maximum relative error of the approximate hypervolumes. */
+        double max_error() const noexcept { return max_error_; }
+
     private:
         void initialize(const GaInfo& ga) override;
         void update(const GaInfo& ga) override;
 
         FitnessVector ref_point_;
+        detail::IncrementalHypervolume incremental_hypervolume_;
+        HypervolumeMethod method_;
+        Positive<double> max_error_;
     };
 
     /**
@@ -66,20 +91,39 @@ namespace gapp::metrics
     * This metric is intended for multi-objective problems, but it also works for
     * single-objective ones.
     * 
-    * @note This metric can be computationally expensive for large populations and dimensions.
+    * @note This metric can be computationally expensive for large populations and dimensions
+    *   when the exact hypervolumes are computed. See Hypervolume for the other methods.
     */
     class AutoHypervolume final : public Monitor<AutoHypervolume, std::vector<double>>
     {
     public:
+        /**
+        * Create a hypervolume metric with an automatically determined reference point.
+        *
+        * @param method The method used to compute the hypervolumes.
+        * @param max_error The maximum relative error of the hypervolumes computed using the
+        *   approximate method. Not used by the other methods.
+        */
+        explicit AutoHypervolume(HypervolumeMethod method = HypervolumeMethod::Exact, Positive<double> max_error = 0.01) noexcept;
+
         /** @returns The reference point used for computing the hypervolumes. */
         const FitnessVector& ref_point() const noexcept { return worst_point_; }
 
+        /** @returns The method used for computing the hypervolumes. */
+        HypervolumeMethod method() const noexcept { return method_; }
+
+        /** @returns The maximum relative error of the approximate hypervolumes. */
+        double max_error() const noexcept { return max_error_; }
+
     private:
         void initialize(const GaInfo& ga) override;
         void update(const GaInfo& ga) override;
 
         FitnessVector worst_point_;
         FitnessMatrix ideal_points_;
+        detail::IncrementalHypervolume incremental_hypervolume_;
+        HypervolumeMethod method_;
+        Positive<double> max_error_;
     };
 
 } // namespace gapp::metrics
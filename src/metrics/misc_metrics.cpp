@@ -4,6 +4,7 @@
 #include "../core/ga_info.hpp"
 #include "../utility/utility.hpp"
 #include <utility>
+#include <chrono>
 #include <cstddef>
 
 namespace gapp::metrics
@@ -22,4 +23,22 @@ namespace gapp::metrics
         data_.push_back(sum_ - old_sum);
     }
 
+    void FitnessEvaluationRate::initialize(const GaInfo& ga)
+    {
+        data_.clear();
+        data_.reserve(ga.max_gen());
+        sum_ = ga.num_fitness_evals();
+        last_update_ = std::chrono::steady_clock::now();
+    }
+
+    void FitnessEvaluationRate::update(const GaInfo& ga)
+    {
+        const size_t old_sum = std::exchange(sum_, ga.num_fitness_evals());
+        const auto old_time = std::exchange(last_update_, std::chrono::steady_clock::now());
+
+        const std::chrono::duration<double> elapsed = last_update_ - old_time;
+
+        data_.push_back(elapsed.count() > 0.0 ? double(sum_ - old_sum) / elapsed.count() : 0.0);
+    }
+
 } // namespace gapp::metrics
@@ -5,6 +5,7 @@
 
 #include "monitor.hpp"
 #include <vector>
+#include <chrono>
 #include <cstddef>
 
 namespace gapp::metrics
@@ -18,6 +19,20 @@ namespace gapp::metrics
         size_t sum_ = 0;
     };
 
+    /**
+    * Record the throughput of the fitness function evaluations in each generation, measured
+    * as the number of evaluations performed per second since the previous generation.
+    * The value recorded for the initial population is always 0.
+    */
+    class FitnessEvaluationRate final : public Monitor<FitnessEvaluationRate, std::vector<double>>
+    {
+        void initialize(const GaInfo& ga) override;
+        void update(const GaInfo& ga) override;
+
+        std::chrono::steady_clock::time_point last_update_;
+        size_t sum_ = 0;
+    };
+
 } // namespace gapp::metrics
 
 #endif // !GA_METRICS_MISC_METRICS_HPP
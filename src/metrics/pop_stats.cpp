@@ -6,6 +6,8 @@
 #include "../utility/algorithm.hpp"
 #include "../utility/iterators.hpp"
 #include "../utility/thread_pool.hpp"
+#include "../utility/qrng.hpp"
+#include "../utility/math.hpp"
 #include "../utility/utility.hpp"
 #include <vector>
 #include <span>
@@ -19,48 +21,142 @@
 
 namespace gapp::detail
 {
-    FitnessVector minFitness(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last)
+    /*
+    * The statistics are computed using parallel reductions over fixed size blocks of the fitness matrix, so the
+    * results are deterministic and don't depend on the number of threads. The block size is large enough that
+    * the statistics of typical population sizes are computed serially on the calling thread.
+    */
+    constexpr size_t STATS_BLOCK_SIZE = 4096;
+
+    /*
+    * Reduce the rows of a fitness matrix in parallel. Each block of rows is reduced by reduce_block(block_first, block_last),
+    * and the results of the blocks are then combined in order on the calling thread using combine(lhs, rhs), which updates lhs.
+    */
+    template<typename T, typename F, typename C>
+    static T reduceFitnessMatrix(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last, const T& fill, F&& reduce_block, C&& combine)
     {
         GAPP_ASSERT(std::distance(first, last) > 0);
 
-        FitnessVector min_fitness = FitnessVector(*first);
+        if (size_t(last - first) <= STATS_BLOCK_SIZE) return std::invoke(reduce_block, first, last);
+
+        auto block_results = detail::parallel_reduce_blocks(first, last, STATS_BLOCK_SIZE, fill, std::forward<F>(reduce_block));
+
+        T result = std::move(block_results.front());
+        for (size_t i = 1; i < block_results.size(); i++) { std::invoke(combine, result, block_results[i]); }
+
+        return result;
+    }
+
+    /* Add the values of each objective in the fitness vectors of rhs to the corresponding values of lhs. */
+    static void addFitnessVectors(FitnessVector& lhs, const FitnessVector& rhs) noexcept
+    {
+        GAPP_ASSERT(lhs.size() == rhs.size());
+
+        for (size_t i = 0; i < lhs.size(); i++) lhs[i] += rhs[i];
+    }
+
+    /* The statistics of a set of fitness vectors used to compute their variance. The statistics of disjoint sets can be combined. */
+    struct FitnessMoments
+    {
+        size_t count = 0;
+        FitnessVector mean;
+        FitnessVector m2; // The sum of the squared differences from the mean
+    };
+
+    /*
+    * Compute the statistics of a block of fitness vectors. The blocks are small enough to stay in the cache, so the mean and the
+    * squared differences from it are computed in two passes over the block instead of updating the mean after every row.
+    */
+    static FitnessMoments fitnessMoments(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last)
+    {
+        const size_t nobjectives = first->size();
+
+        FitnessMoments moments{ size_t(last - first), FitnessVector(nobjectives, 0.0), FitnessVector(nobjectives, 0.0) };
+
+        for (auto it = first; it != last; ++it)
+        {
+            const auto fvec = *it;
+            for (size_t i = 0; i < nobjectives; i++) moments.mean[i] += fvec[i];
+        }
+
+        const double ninv = 1.0 / double(moments.count);
+        for (double& f : moments.mean) f *= ninv;
 
-        while (++first != last)
+        for (auto it = first; it != last; ++it)
         {
-            detail::elementwise_min(min_fitness, *first, detail::inplace_t{});
+            const auto fvec = *it;
+            for (size_t i = 0; i < nobjectives; i++)
+            {
+                const double diff = fvec[i] - moments.mean[i];
+                moments.m2[i] += diff * diff;
+            }
         }
 
-        return min_fitness;
+        return moments;
     }
 
-    FitnessVector maxFitness(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last)
+    /* Combine the statistics of two disjoint sets of fitness vectors into lhs (Chan et al.). */
+    static void combineFitnessMoments(FitnessMoments& lhs, const FitnessMoments& rhs) noexcept
     {
-        GAPP_ASSERT(std::distance(first, last) > 0);
+        GAPP_ASSERT(lhs.mean.size() == rhs.mean.size());
 
-        FitnessVector max_fitness = FitnessVector(*first);
+        const double nleft = double(lhs.count);
+        const double nright = double(rhs.count);
+        const double ninv = 1.0 / (nleft + nright);
 
-        while (++first != last)
+        for (size_t i = 0; i < lhs.mean.size(); i++)
         {
-            detail::elementwise_max(max_fitness, *first, detail::inplace_t{});
+            const double delta = rhs.mean[i] - lhs.mean[i];
+            lhs.mean[i] += delta * nright * ninv;
+            lhs.m2[i] += rhs.m2[i] + delta * delta * nleft * nright * ninv;
         }
+        lhs.count += rhs.count;
+    }
+
+    FitnessVector minFitness(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last)
+    {
+        GAPP_ASSERT(std::distance(first, last) > 0);
 
-        return max_fitness;
+        return reduceFitnessMatrix(first, last, FitnessVector{}, [](auto block_first, auto block_last)
+        {
+            FitnessVector min_fitness = FitnessVector(*block_first);
+            while (++block_first != block_last) detail::elementwise_min(min_fitness, *block_first, detail::inplace_t{});
+            return min_fitness;
+        },
+        [](FitnessVector& lhs, const FitnessVector& rhs) { detail::elementwise_min(lhs, rhs, detail::inplace_t{}); });
     }
 
-    FitnessVector fitnessMean(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last)
+    FitnessVector maxFitness(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last)
     {
         GAPP_ASSERT(std::distance(first, last) > 0);
 
-        const double ninv = 1.0 / (last - first);
-        FitnessVector fitness_mean(first->size());
+        return reduceFitnessMatrix(first, last, FitnessVector{}, [](auto block_first, auto block_last)
+        {
+            FitnessVector max_fitness = FitnessVector(*block_first);
+            while (++block_first != block_last) detail::elementwise_max(max_fitness, *block_first, detail::inplace_t{});
+            return max_fitness;
+        },
+        [](FitnessVector& lhs, const FitnessVector& rhs) { detail::elementwise_max(lhs, rhs, detail::inplace_t{}); });
+    }
+
+    FitnessVector fitnessMean(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last)
+    {
+        GAPP_ASSERT(std::distance(first, last) > 0);
 
-        std::for_each(first, last, [&](const auto& fvec) noexcept
+        FitnessVector fitness_mean = reduceFitnessMatrix(first, last, FitnessVector{}, [](auto block_first, auto block_last)
         {
-            for (size_t i = 0; i < fvec.size(); i++)
+            FitnessVector fitness_sum(block_first->size(), 0.0);
+            for (; block_first != block_last; ++block_first)
             {
-                fitness_mean[i] += fvec[i] * ninv;
+                const auto fvec = *block_first;
+                for (size_t i = 0; i < fvec.size(); i++) fitness_sum[i] += fvec[i];
             }
-        });
+            return fitness_sum;
+        },
+        addFitnessVectors);
+
+        const double ninv = 1.0 / double(last - first);
+        for (double& f : fitness_mean) f *= ninv;
 
         return fitness_mean;
     }
@@ -70,25 +166,42 @@ namespace gapp::detail
         GAPP_ASSERT(std::distance(first, last) > 0);
         GAPP_ASSERT(first->size() == fitness_mean.size());
 
-        const double ninv = 1.0 / (last - first - 1.0);
-        FitnessVector fitness_variance(first->size(), 0.0);
-
-        if (std::distance(first, last) == 1) return fitness_variance;
+        if (std::distance(first, last) == 1) return FitnessVector(first->size(), 0.0);
 
-        std::for_each(first, last, [&](const auto& fitness_vector) noexcept
+        FitnessVector fitness_variance = reduceFitnessMatrix(first, last, FitnessVector{}, [&](auto block_first, auto block_last)
         {
-            for (size_t i = 0; i < fitness_vector.size(); i++)
+            FitnessVector sum_sq_diff(block_first->size(), 0.0);
+            for (; block_first != block_last; ++block_first)
             {
-                fitness_variance[i] += std::pow(fitness_vector[i] - fitness_mean[i], 2) * ninv;
+                const auto fvec = *block_first;
+                for (size_t i = 0; i < fvec.size(); i++)
+                {
+                    const double diff = fvec[i] - fitness_mean[i];
+                    sum_sq_diff[i] += diff * diff;
+                }
             }
-        });
+            return sum_sq_diff;
+        },
+        addFitnessVectors);
+
+        const double ninv = 1.0 / (last - first - 1.0);
+        for (double& f : fitness_variance) f *= ninv;
 
         return fitness_variance;
     }
 
     FitnessVector fitnessVariance(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last)
     {
-        return fitnessVariance(first, last, fitnessMean(first, last));
+        GAPP_ASSERT(std::distance(first, last) > 0);
+
+        if (std::distance(first, last) == 1) return FitnessVector(first->size(), 0.0);
+
+        FitnessVector fitness_variance = reduceFitnessMatrix(first, last, FitnessMoments{}, fitnessMoments, combineFitnessMoments).m2;
+
+        const double ninv = 1.0 / (last - first - 1.0);
+        for (double& f : fitness_variance) f *= ninv;
+
+        return fitness_variance;
     }
 
     FitnessVector fitnessStdDev(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last, std::span<const double> mean)
@@ -101,7 +214,10 @@ namespace gapp::detail
 
     FitnessVector fitnessStdDev(FitnessMatrix::const_iterator first, FitnessMatrix::const_iterator last)
     {
-        return fitnessStdDev(first, last, fitnessMean(first, last));
+        FitnessVector fitness_std_dev = fitnessVariance(first, last);
+        for (double& f : fitness_std_dev) { f = std::sqrt(f); }
+
+        return fitness_std_dev;
     }
 
 
@@ -202,4 +318,179 @@ namespace gapp::detail
         return hypervolume(par{}, fmat, ref_point);
     }
 
+
+    /*
+    *   APPROXIMATE HYPERVOLUME
+    *
+    * The hypervolume is estimated by sampling points in the box between the reference point and the ideal
+    * point of the pareto front, using a quasi-random sequence instead of uniformly random points in order to
+    * reduce the error of the estimate. The hypervolume is the volume of the box multiplied by the ratio of the
+    * samples dominated by the front.
+    * The stopping criterion uses the standard error of the plain Monte Carlo estimate, which
+    * overestimates the error of the quasi-Monte Carlo estimate.
+    */
+
+    static inline bool isDominatedByFront(std::span<const double> point, const FitnessMatrix& front) noexcept
+    {
+        /* The front is sorted in descending order along the first objective, so only a prefix of it can dominate the point. */
+        const auto last = std::partition_point(front.begin(), front.end(), [&](const auto& row) { return row[0] >= point[0]; });
+
+        return std::any_of(front.begin(), last, [&](const auto& row)
+        {
+            return std::equal(row.begin(), row.end(), point.begin(), point.end(), std::greater_equal{});
+        });
+    }
+
+    double hypervolumeApprox(const FitnessMatrix& fmat, std::span<const double> ref_point, double max_error, size_t max_samples)
+    {
+        GAPP_ASSERT(fmat.empty() || fmat.ncols() == ref_point.size());
+        GAPP_ASSERT(max_error > 0.0);
+
+        constexpr size_t batch_size = 4096;
+
+        if (fmat.empty()) return 0.0;
+
+        const FitnessMatrix front = uniqueSortedParetoFront(fmat);
+        const FitnessVector ideal_point = maxFitness(front.begin(), front.end());
+
+        const double box_volume = math::volumeBetween(ideal_point, ref_point);
+
+        if (front.size() == 1 || box_volume == 0.0) return box_volume;
+
+        rng::QuasiRandom<double> qrng(ref_point.size());
+        FitnessMatrix samples(batch_size, ref_point.size());
+        std::vector<char> is_dominated(batch_size);
+
+        size_t nsamples = 0;
+        size_t ndominated = 0;
+
+        while (nsamples < max_samples)
+        {
+            const size_t nbatch = std::min(batch_size, max_samples - nsamples);
+
+            for (size_t i = 0; i < nbatch; i++)
+            {
+                const auto unit_point = qrng();
+                for (size_t j = 0; j < ref_point.size(); j++)
+                {
+                    samples[i][j] = ref_point[j] + unit_point[j] * (ideal_point[j] - ref_point[j]);
+                }
+            }
+
+            detail::parallel_for(detail::iota_iterator(0_sz), detail::iota_iterator(nbatch), [&](size_t idx)
+            {
+                is_dominated[idx] = isDominatedByFront(samples[idx], front);
+            });
+
+            ndominated += std::count(is_dominated.begin(), is_dominated.begin() + nbatch, char(true));
+            nsamples += nbatch;
+
+            const double ratio = double(ndominated) / nsamples;
+            if (ratio > 0.0 && std::sqrt((1.0 - ratio) / (ratio * nsamples)) <= max_error) break;
+        }
+
+        return box_volume * double(ndominated) / nsamples;
+    }
+
+
+    /*
+    *   INCREMENTAL HYPERVOLUME
+    *
+    * The hypervolume of a point set changes by the exclusive hypervolume of a point when the point is added
+    * to or removed from the set, so the hypervolume of the new front can be computed from the hypervolume of
+    * the previous one by removing the points not in the new front one at a time, and then adding the new
+    * points one at a time. This is cheaper than recomputing the hypervolume as long as only a small part
+    * of the front changes between generations.
+    *
+    * The rounding errors of the updates would accumulate over many generations, so the hypervolume is still
+    * recomputed from scratch after every RECOMPUTE_INTERVAL incremental updates.
+    */
+
+    /* The change in the hypervolume of points[:first] after adding the points points[first:] to it. */
+    static double addedHypervolume(const FitnessMatrix& points, size_t first, std::span<const double> ref_point)
+    {
+        /* The contributions are summed in a fixed order so the result doesn't depend on the scheduling of the threads. */
+        std::vector<double> contributions(points.size() - first);
+
+        detail::parallel_for(detail::iota_iterator(first), detail::iota_iterator(points.size()), [&](size_t idx)
+        {
+            const FitnessMatrix rest = { points.begin(), points.begin() + idx };
+
+            contributions[idx - first] = exclusiveHypervolume(points[idx], rest, ref_point);
+        });
+
+        return std::accumulate(contributions.begin(), contributions.end(), 0.0);
+    }
+
+    double IncrementalHypervolume::update(const FitnessMatrix& fmat, std::span<const double> ref_point)
+    {
+        FitnessMatrix front = uniqueSortedParetoFront(fmat);
+
+        auto recompute = [&]
+        {
+            hypervolume_ = hypervolume(front, ref_point);
+            front_ = std::move(front);
+            ref_point_.assign(ref_point.begin(), ref_point.end());
+            incremental_updates_ = 0;
+
+            return hypervolume_;
+        };
+
+        if (front_.empty() || incremental_updates_ >= RECOMPUTE_INTERVAL || !std::equal(ref_point.begin(), ref_point.end(), ref_point_.begin(), ref_point_.end()))
+        {
+            return recompute();
+        }
+
+        /* Both fronts are sorted in lexicographically descending order, so their differences can be found by merging them. */
+        auto greater = [](const auto& lhs, const auto& rhs)
+        {
+            return std::lexicographical_compare(rhs.begin(), rhs.end(), lhs.begin(), lhs.end());
+        };
+
+        FitnessMatrix common;
+        FitnessMatrix removed;
+        FitnessMatrix added;
+
+        size_t old_idx = 0;
+        size_t new_idx = 0;
+
+        while (old_idx < front_.size() && new_idx < front.size())
+        {
+            if (front_[old_idx] == front[new_idx])
+            {
+                common.append_row(front[new_idx]);
+                old_idx++; new_idx++;
+            }
+            else if (greater(front_[old_idx], front[new_idx])) removed.append_row(front_[old_idx++]);
+            else added.append_row(front[new_idx++]);
+        }
+        while (old_idx < front_.size()) removed.append_row(front_[old_idx++]);
+        while (new_idx < front.size()) added.append_row(front[new_idx++]);
+
+        if (removed.size() + added.size() >= front.size()) return recompute();
+
+        const size_t ncommon = common.size();
+
+        FitnessMatrix old_points = common;
+        for (const auto& point : removed) old_points.append_row(point);
+
+        FitnessMatrix new_points = std::move(common);
+        for (const auto& point : added) new_points.append_row(point);
+
+        hypervolume_ -= addedHypervolume(old_points, ncommon, ref_point);
+        hypervolume_ += addedHypervolume(new_points, ncommon, ref_point);
+        front_ = std::move(front);
+        incremental_updates_++;
+
+        return hypervolume_;
+    }
+
+    void IncrementalHypervolume::reset() noexcept
+    {
+        front_.clear();
+        ref_point_.clear();
+        hypervolume_ = 0.0;
+        incremental_updates_ = 0;
+    }
+
 } // namespace gapp::detail
\ No newline at end of file
@@ -32,6 +32,38 @@ namespace gapp::detail
     /* Compute the hypervolume of a set of points relative to a reference point. Works for any number of dimensions. */
     double hypervolume(const FitnessMatrix& fmat, std::span<const double> ref_point);
 
+    /*
+    * Estimate the hypervolume of a set of points relative to a reference point using quasi-Monte Carlo sampling.
+    * Points are sampled until the estimated relative standard error of the result is less than max_error,
+    * or until max_samples points were sampled.
+    */
+    double hypervolumeApprox(const FitnessMatrix& fmat, std::span<const double> ref_point, double max_error, size_t max_samples = 1'000'000);
+
+    /*
+    * Computes the exact hypervolumes of a sequence of point sets relative to a reference point. The hypervolume
+    * of each set is computed from the hypervolume of the previous one, based on the points that were removed from
+    * and added to the pareto front of the set. The hypervolume is recomputed from scratch if most of the points
+    * of the pareto front changed, or the reference point is different. It is also recomputed periodically, so the
+    * rounding errors of the incremental updates don't accumulate over long runs.
+    */
+    class IncrementalHypervolume
+    {
+    public:
+        /* Compute the hypervolume of fmat, assuming that it is the successor of the previous point set. */
+        double update(const FitnessMatrix& fmat, std::span<const double> ref_point);
+
+        /* Forget the previous point set. */
+        void reset() noexcept;
+
+    private:
+        FitnessMatrix front_;
+        FitnessVector ref_point_;
+        double hypervolume_ = 0.0;
+        size_t incremental_updates_ = 0;
+
+        static constexpr size_t RECOMPUTE_INTERVAL = 100;
+    };
+
 } // namespace gapp::detail
 
 #endif // !GA_METRICS_POP_STATS_HPP
@@ -112,6 +112,8 @@ namespace gapp::mutation
         */
         virtual void mutate(const GA<T>& ga, const Candidate<T>& candidate, Chromosome<T>& chromosome) const = 0;
 
+        static void recordChanges(const Candidate<T>& old_candidate, Candidate<T>& candidate);
+
         Probability pm_;
     };
 
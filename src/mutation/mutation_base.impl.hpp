@@ -7,6 +7,8 @@
 #include "../core/ga_base.decl.hpp"
 #include "../utility/utility.hpp"
 #include <algorithm>
+#include <functional>
+#include <numeric>
 #include <utility>
 
 namespace gapp::mutation
@@ -17,6 +19,8 @@ namespace gapp::mutation
         GAPP_ASSERT(candidate.fitness.empty() || candidate.fitness.size() == ga.num_objectives());
         GAPP_ASSERT(allow_variable_chrom_length() || candidate.chromosome.size() == ga.chrom_len());
 
+        candidate.changes.clear();
+
         if (!candidate.is_evaluated())
         {
             mutate(ga, candidate, candidate.chromosome);
@@ -29,13 +33,44 @@ namespace gapp::mutation
             thread_local Candidate<T> old_candidate; old_candidate = candidate;
 
             mutate(ga, candidate, candidate.chromosome);
-            if (candidate != old_candidate) candidate.fitness.clear();
+            if (candidate != old_candidate)
+            {
+                /* Record the changed genes so the fitness can be computed from the old one (delta evaluation). */
+                recordChanges(old_candidate, candidate);
+                candidate.fitness.clear();
+            }
         }
 
         GAPP_ASSERT(allow_variable_chrom_length() || candidate.chromosome.size() == ga.chrom_len(),
                   "The mutation resulted in a candidate with incorrect chromosome length.");
     }
 
+    template<typename T>
+    void Mutation<T>::recordChanges(const Candidate<T>& old_candidate, Candidate<T>& candidate)
+    {
+        const size_t chrom_len = candidate.chromosome.size();
+
+        if (old_candidate.chromosome.size() != chrom_len) return;
+
+        const size_t num_changed = std::inner_product(candidate.chromosome.begin(), candidate.chromosome.end(),
+                                                      old_candidate.chromosome.begin(), 0_sz, std::plus<>{}, std::not_equal_to<>{});
+
+        /* The delta evaluation isn't worth it if most of the genes were changed. */
+        if (2 * num_changed > chrom_len) return;
+
+        /* The storage of the changes is kept by the candidate, so this will usually not allocate. */
+        candidate.changes.genes.reserve(num_changed);
+
+        for (size_t idx = 0; idx < chrom_len; idx++)
+        {
+            if (candidate.chromosome[idx] == old_candidate.chromosome[idx]) continue;
+
+            candidate.changes.genes.push_back({ idx, old_candidate.chromosome[idx] });
+        }
+
+        candidate.changes.parent_fitness = old_candidate.fitness;
+    }
+
 } // namespace gapp::mutation
 
 #endif // !GA_MUTATION_BASE_IMPL_HPP
\ No newline at end of file
@@ -8,11 +8,11 @@
 
 namespace gapp::problems
 {
-    Candidate<RealGene> BenchmarkFunction<RealGene>::convert(const Candidate<BinaryGene>& sol, const BoundsVector<RealGene>& bounds, size_t var_bits) const
+    void BenchmarkFunction<RealGene>::convert(const Candidate<BinaryGene>& sol, const BoundsVector<RealGene>& bounds, size_t var_bits, Candidate<RealGene>& new_sol) const
     {
         GAPP_ASSERT(sol.chromosome.size() == var_bits * bounds.size());
 
-        Candidate<RealGene> new_sol(bounds.size());
+        new_sol.chromosome.resize(bounds.size());
 
         for (size_t i = 0; i < new_sol.size(); i++)
         {
@@ -26,8 +26,6 @@ namespace gapp::problems
 
             new_sol[i] = val * (bounds[i].upper() - bounds[i].lower()) + bounds[i].lower();
         }
-
-        return new_sol;
     }
 
 } // namespace gapp::problems
@@ -137,6 +137,9 @@ namespace gapp::problems
         using FitnessFunctionBase<RealGene>::operator();
         using FitnessFunctionBase<BinaryGene>::operator();
 
+        using FitnessFunctionBase<RealGene>::evaluate_delta;
+        using FitnessFunctionBase<BinaryGene>::evaluate_delta;
+
         /** @returns The number of variables of the benchmark function. */
         [[nodiscard]]
         size_t num_vars() const noexcept { return FitnessFunctionBase<RealGene>::chrom_len(); }
@@ -180,10 +183,15 @@ namespace gapp::problems
         FitnessVector invoke(const Candidate<BinaryGene>& chrom) const final
         {
             size_t var_bits = FitnessFunctionBase<BinaryGene>::chrom_len() / FitnessFunctionBase<RealGene>::chrom_len();
-            return this->invoke(convert(chrom, bounds(), var_bits));
+
+            /* The decoded candidate is reused between the calls to avoid allocating a new one for every evaluation. */
+            thread_local Candidate<RealGene> real_sol;
+            convert(chrom, bounds(), var_bits, real_sol);
+
+            return this->invoke(real_sol);
         }
 
-        Candidate<RealGene> convert(const Candidate<BinaryGene>& sol, const BoundsVector<RealGene>& bounds, size_t var_bits) const;
+        void convert(const Candidate<BinaryGene>& sol, const BoundsVector<RealGene>& bounds, size_t var_bits, Candidate<RealGene>& new_sol) const;
     };
 
 } // namespace gapp::problems
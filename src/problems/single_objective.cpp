@@ -5,6 +5,7 @@
 #include "../utility/functional.hpp"
 #include <numeric>
 #include <numbers>
+#include <span>
 #include <cmath>
 #include <cstddef>
 
@@ -18,6 +19,17 @@ namespace gapp::problems
         return { -std::inner_product(sol.begin(), sol.end(), sol.begin(), 0.0) };
     }
 
+    auto Sphere::invoke_delta(const FitnessVector& parent_fitness, const Candidate<RealGene>& sol, std::span<const GeneChange<RealGene>> changes) const -> FitnessVector
+    {
+        double fx = -parent_fitness[0];
+        for (const auto& [idx, old_value] : changes)
+        {
+            fx += sol[idx] * sol[idx] - old_value * old_value;
+        }
+
+        return { -fx };
+    }
+
     auto Rastrigin::invoke(const Candidate<RealGene>& sol) const -> FitnessVector
     {
         double fx = 10.0 * sol.size();
@@ -29,6 +41,18 @@ namespace gapp::problems
         return { -fx };
     }
 
+    auto Rastrigin::invoke_delta(const FitnessVector& parent_fitness, const Candidate<RealGene>& sol, std::span<const GeneChange<RealGene>> changes) const -> FitnessVector
+    {
+        double fx = -parent_fitness[0];
+        for (const auto& [idx, old_value] : changes)
+        {
+            fx += std::pow(sol[idx], 2) - 10.0 * std::cos(2.0 * pi * sol[idx]);
+            fx -= std::pow(old_value, 2) - 10.0 * std::cos(2.0 * pi * old_value);
+        }
+
+        return { -fx };
+    }
+
     auto Rosenbrock::invoke(const Candidate<RealGene>& sol) const -> FitnessVector
     {
         GAPP_ASSERT(!sol.empty());
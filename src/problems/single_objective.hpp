@@ -5,6 +5,7 @@
 
 #include "benchmark_function.hpp"
 #include "../encoding/gene_types.hpp"
+#include <span>
 #include <cstddef>
 
 namespace gapp::problems
@@ -36,6 +37,7 @@ namespace gapp::problems
 
     private:
         FitnessVector invoke(const Candidate<RealGene>& sol) const override;
+        FitnessVector invoke_delta(const FitnessVector& parent_fitness, const Candidate<RealGene>& sol, std::span<const GeneChange<RealGene>> changes) const override;
     };
 
 
@@ -70,6 +72,7 @@ namespace gapp::problems
 
     private:
         FitnessVector invoke(const Candidate<RealGene>& sol) const override;
+        FitnessVector invoke_delta(const FitnessVector& parent_fitness, const Candidate<RealGene>& sol, std::span<const GeneChange<RealGene>> changes) const override;
     };
 
 
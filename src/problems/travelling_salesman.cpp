@@ -1,6 +1,7 @@
 ﻿/* Copyright (c) 2022 Krisztián Rugási. Subject to the MIT License. */
 
 #include "travelling_salesman.hpp"
+#include <algorithm>
 #include <span>
 #include <cmath>
 #include <cstddef>
@@ -42,4 +43,38 @@ namespace gapp::problems
         return { -distance }; /* For maximization. */
     }
 
+    auto TSP::invoke_delta(const FitnessVector& parent_fitness, const Candidate<PermutationGene>& sol, std::span<const GeneChange<PermutationGene>> changes) const -> FitnessVector
+    {
+        const size_t ncities = distance_matrix_.size();
+        const size_t tour_len = sol.size() + 2;
+
+        /* The positions of the tour are shifted by one compared to the chromosome, the first and last positions are the fixed city. */
+        const auto new_city = [&](size_t pos) -> size_t
+        {
+            return (pos == 0 || pos == tour_len - 1) ? ncities - 1 : sol[pos - 1];
+        };
+
+        const auto old_city = [&](size_t pos) -> size_t
+        {
+            const auto change = std::lower_bound(changes.begin(), changes.end(), pos - 1, [](const auto& lhs, size_t idx) { return lhs.index < idx; });
+            return (change != changes.end() && change->index == pos - 1) ? change->old_value : new_city(pos);
+        };
+
+        /* Only the edges that are adjacent to a changed city have to be updated. */
+        double distance = -parent_fitness[0];
+        size_t next_edge = 0;
+
+        for (const auto& change : changes)
+        {
+            for (size_t edge = std::max(change.index, next_edge); edge <= change.index + 1; edge++)
+            {
+                distance += distance_matrix_[new_city(edge)][new_city(edge + 1)];
+                distance -= distance_matrix_[old_city(edge)][old_city(edge + 1)];
+            }
+            next_edge = change.index + 2;
+        }
+
+        return { -distance }; /* For maximization. */
+    }
+
 } // namespace gapp::problems
@@ -28,6 +28,7 @@ namespace gapp::problems
 
     private:
         FitnessVector invoke(const Candidate<PermutationGene>& sol) const override;
+        FitnessVector invoke_delta(const FitnessVector& parent_fitness, const Candidate<PermutationGene>& sol, std::span<const GeneChange<PermutationGene>> changes) const override;
 
         DistanceMatrix distance_matrix_;
     };
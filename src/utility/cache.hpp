@@ -7,6 +7,8 @@
 #include "concepts.hpp"
 #include "utility.hpp"
 #include <unordered_map>
+#include <functional>
+#include <concepts>
 #include <type_traits>
 #include <memory>
 #include <utility>
@@ -172,6 +174,13 @@ namespace gapp::detail
         //               OTHER               //
         //-----------------------------------//
 
+        /* Invoke f on each of the (key, value) pairs of the cache, starting with the oldest one. */
+        template<std::invocable<const key_type&, const value_type&> F>
+        constexpr void for_each(F&& f) const
+        {
+            for (auto it : order_) { std::invoke(f, it->first, it->second); }
+        }
+
         constexpr friend bool operator==(const fifo_cache& lhs, const fifo_cache& rhs)
         {
             if (lhs.size() != rhs.size()) return false;
@@ -33,8 +33,13 @@ namespace gapp::detail
         points_.reserve(points.size(), points[0].size());
         for (const Point& point : points) points_.append_row(point);
 
-        nodes_.reserve(4 * points_.size() / MAX_LEAF_ELEMENTS);
-        nodes_.push_back({ .first = 0, .last = points_.size() });
+        buildTree();
+    }
+
+    ConeTree::ConeTree(const Matrix<double>& points) :
+        points_(points)
+    {
+        if (points_.empty()) return;
 
         buildTree();
     }
@@ -85,6 +90,36 @@ namespace gapp::detail
         return std::sqrt(distance(*furthest));
     }
 
+    /* Find the bounding cone of the points in the node (the max angle between the center and the points), and the range of their norms. */
+    static inline void findBoundingCone(Node& node, const_iterator first, const_iterator last)
+    {
+        GAPP_ASSERT(std::distance(first, last) > 0);
+
+        const double center_norm = node.center_norm = math::euclideanNorm(node.center);
+
+        node.cos_angle = 1.0;
+        node.min_norm = math::inf<double>;
+        node.max_norm = 0.0;
+
+        for (; first != last; ++first)
+        {
+            const double norm = math::euclideanNorm(*first);
+
+            node.min_norm = std::min(node.min_norm, norm);
+            node.max_norm = std::max(node.max_norm, norm);
+
+            /* The angle of a zero vector is undefined, but its inner product with anything is 0, which is handled by min_norm. */
+            if (norm == 0.0) continue;
+
+            const double cos_angle = (center_norm == 0.0) ? -1.0 :
+                std::inner_product(first->begin(), first->end(), node.center.begin(), 0.0) / (norm * center_norm);
+
+            node.cos_angle = std::min(node.cos_angle, std::clamp(cos_angle, -1.0, 1.0));
+        }
+
+        node.sin_angle = std::sqrt(1.0 - node.cos_angle * node.cos_angle);
+    }
+
     /* Returns true if the node is a leaf node. */
     static inline bool isLeafNode(const Node& node) noexcept
     {
@@ -95,8 +130,21 @@ namespace gapp::detail
     static inline double innerProductUpperBound(const Node& node, PointRef point, double point_norm)
     {
         const double center_prod = std::inner_product(point.begin(), point.end(), node.center.begin(), 0.0);
+        const double ball_bound = center_prod + point_norm * node.radius;
+
+        if (point_norm == 0.0) return 0.0;
+
+        /* The cone bound: the angle between the point and any point in the node is at least (angle(point, center) - max_angle). */
+        if (node.center_norm == 0.0) return ball_bound;
+
+        const double cos_center = std::clamp(center_prod / (point_norm * node.center_norm), -1.0, 1.0);
+        if (cos_center >= node.cos_angle) return std::min(ball_bound, point_norm * node.max_norm);
 
-        return center_prod + point_norm * node.radius;
+        const double sin_center = std::sqrt(1.0 - cos_center * cos_center);
+        const double cos_bound = cos_center * node.cos_angle + sin_center * node.sin_angle;
+        const double cone_bound = point_norm * cos_bound * (cos_bound >= 0.0 ? node.max_norm : node.min_norm);
+
+        return std::min(ball_bound, cone_bound);
     }
 
     /* Find the best match in the range [first, last) using linear search. */
@@ -123,7 +171,11 @@ namespace gapp::detail
 
     void ConeTree::buildTree()
     {
-        GAPP_ASSERT(nodes_.size() == 1);
+        indices_.resize(points_.size());
+        std::iota(indices_.begin(), indices_.end(), 0_sz);
+
+        nodes_.reserve(4 * points_.size() / MAX_LEAF_ELEMENTS);
+        nodes_.push_back({ .first = 0, .last = points_.size() });
 
         for (size_t i = 0; i < nodes_.size(); i++)
         {
@@ -131,6 +183,7 @@ namespace gapp::detail
 
             node.center = findCenter(node_cbegin(node), node_cend(node));
             node.radius = findRadius(node_cbegin(node), node_cend(node), node.center);
+            findBoundingCone(node, node_cbegin(node), node_cend(node));
 
             /* Leaf node. */
             if (node.last - node.first <= MAX_LEAF_ELEMENTS)
@@ -143,18 +196,35 @@ namespace gapp::detail
             {
                 const auto partition_points = partitionPoints(node_cbegin(node), node_cend(node));
 
-                auto middle = std::partition(node_begin(node), node_end(node), [&](auto point)
+                /* The partition points are copied, since they might be moved by the partitioning. */
+                const Point left_point(*partition_points.first);
+                const Point right_point(*partition_points.second);
+
+                auto is_left = [&](size_t idx)
                 {
-                    const double left_dist = math::euclideanDistanceSq(point, *partition_points.first);
-                    const double right_dist = math::euclideanDistanceSq(point, *partition_points.second);
+                    const double left_dist = math::euclideanDistanceSq(points_[idx], left_point);
+                    const double right_dist = math::euclideanDistanceSq(points_[idx], right_point);
 
                     return left_dist < right_dist;
-                });
+                };
 
-                /* Handle edge case where all of the points in [first, last) are the same (making sure both child ranges will be non-empty). */
-                if (middle == node_begin(node)) ++middle;
+                /* The points are partitioned manually in order to keep the original indices in sync with them. */
+                size_t middle_idx = node.first;
+                size_t last_idx = node.last;
 
-                const size_t middle_idx = size_t(middle - points_.begin());
+                while (true)
+                {
+                    while (middle_idx < last_idx && is_left(middle_idx)) ++middle_idx;
+                    while (middle_idx < last_idx && !is_left(last_idx - 1)) --last_idx;
+
+                    if (middle_idx >= last_idx) break;
+
+                    swap(points_[middle_idx], points_[last_idx - 1]);
+                    std::swap(indices_[middle_idx], indices_[last_idx - 1]);
+                }
+
+                /* Handle edge case where all of the points in [first, last) are the same (making sure both child ranges will be non-empty). */
+                if (middle_idx == node.first) ++middle_idx;
 
                 Node left_child{ .first = node.first, .last = middle_idx };
                 Node right_child{ .first = middle_idx, .last = node.last };
@@ -192,11 +262,11 @@ namespace gapp::detail
 
             if (isLeafNode(*node))
             {
-                auto [elem, inner_prod] = findBestMatchLinear(query_point, node_begin(*node), node_end(*node));
-                if (inner_prod > best.prod)
+                const FindResult leaf_best = findBestMatchLinear(query_point, node_begin(*node), node_end(*node));
+                if (leaf_best.prod > best.prod)
                 {
-                    best.elem = elem;
-                    best.prod = inner_prod;
+                    best.elem = leaf_best.elem;
+                    best.prod = leaf_best.prod;
                 }
             }
             else
@@ -219,6 +289,8 @@ namespace gapp::detail
             }
         }
 
+        if (best.prod != -math::inf<double>) best.idx = indices_[size_t(best.elem - points_.begin())];
+
         return best;
     }
 
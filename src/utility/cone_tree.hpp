@@ -32,12 +32,18 @@ namespace gapp::detail
         {
             const_iterator elem;
             double prod;
+            size_t idx = 0; /* The index of the point in the range the tree was constructed from. */
         };
 
         struct Node
         {
             Point center  = {}; // NOLINT(*redundant-member-init)
             double radius = 0.0;
+            double center_norm = 0.0;
+            double cos_angle = 1.0; /* The cosine of the max angle between the center and the points of the node. */
+            double sin_angle = 0.0; /* The sine of the max angle between the center and the points of the node. */
+            double min_norm  = 0.0; /* The smallest norm of the points which belong to the node. */
+            double max_norm  = 0.0; /* The largest norm of the points which belong to the node. */
             size_t first  = 0;  /* Index of the first point which belongs to the node. */
             size_t last   = 0;  /* Index of the first point which does not belong to the node. */
 
@@ -49,6 +55,8 @@ namespace gapp::detail
 
         explicit ConeTree(std::span<const Point> points);
 
+        explicit ConeTree(const Matrix<double>& points);
+
         /* Returns the closest point in the tree to the query point, and its distance. */
         FindResult findBestMatch(PointRef query_point) const;
 
@@ -62,9 +70,10 @@ namespace gapp::detail
 
     private:
         Matrix<double> points_;
+        std::vector<size_t> indices_;   /* The original indices of the points, as they are reordered while building the tree. */
         std::vector<Node> nodes_;
 
-        static constexpr size_t MAX_LEAF_ELEMENTS = 8;  /* The maximum number of points in a leaf node. */
+        static constexpr size_t MAX_LEAF_ELEMENTS = 32;  /* The maximum number of points in a leaf node. */
 
         void buildTree();
 
@@ -0,0 +1,172 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#include "cpu_topology.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <numeric>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <charconv>
+#include <system_error>
+#include <climits>
+
+#if defined(_WIN32)
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   include <windows.h>
+#elif defined(__linux__)
+#   include <pthread.h>
+#   include <sched.h>
+#endif
+
+namespace gapp::detail
+{
+    std::vector<size_t> parse_cpu_list(std::string_view str)
+    {
+        std::vector<size_t> cpus;
+
+        /* The list ends with a newline when it's read from a file. */
+        while (!str.empty() && (str.back() == '\n' || str.back() == ' ')) str.remove_suffix(1);
+
+        const auto parse_number = [&](size_t& value)
+        {
+            const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+            str.remove_prefix(size_t(ptr - str.data()));
+            return ec == std::errc{};
+        };
+
+        while (!str.empty())
+        {
+            size_t first = 0;
+            if (!parse_number(first)) return {};
+
+            size_t last = first;
+            if (!str.empty() && str.front() == '-')
+            {
+                str.remove_prefix(1);
+                if (!parse_number(last) || last < first) return {};
+            }
+
+            for (size_t cpu = first; cpu <= last; cpu++) cpus.push_back(cpu);
+
+            if (str.empty()) break;
+            if (str.front() != ',' || str.size() == 1) return {};
+            str.remove_prefix(1);
+        }
+
+        return cpus;
+    }
+
+#if defined(_WIN32)
+
+    bool set_thread_affinity(std::jthread& thread, size_t cpu) noexcept
+    {
+        /* Only the first processor group is supported. */
+        if (cpu >= sizeof(DWORD_PTR) * CHAR_BIT) return false;
+
+        return SetThreadAffinityMask(thread.native_handle(), DWORD_PTR(1) << cpu) != 0;
+    }
+
+    static std::vector<NumaNode> detect_numa_nodes()
+    {
+        std::vector<NumaNode> nodes;
+
+        ULONG highest_node = 0;
+        if (!GetNumaHighestNodeNumber(&highest_node)) return nodes;
+
+        for (ULONG node = 0; node <= highest_node; node++)
+        {
+            ULONGLONG mask = 0;
+            if (!GetNumaNodeProcessorMask(UCHAR(node), &mask) || mask == 0) continue;
+
+            std::vector<size_t> cpus;
+            for (size_t cpu = 0; cpu < sizeof(mask) * CHAR_BIT; cpu++)
+            {
+                if (mask & (ULONGLONG(1) << cpu)) cpus.push_back(cpu);
+            }
+            nodes.push_back({ size_t(node), std::move(cpus) });
+        }
+
+        return nodes;
+    }
+
+#elif defined(__linux__)
+
+    bool set_thread_affinity(std::jthread& thread, size_t cpu) noexcept
+    {
+        if (cpu >= CPU_SETSIZE) return false;
+
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(cpu, &cpu_set);
+
+        return pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set), &cpu_set) == 0;
+    }
+
+    static std::vector<NumaNode> detect_numa_nodes()
+    {
+        namespace fs = std::filesystem;
+
+        std::vector<NumaNode> nodes;
+        std::error_code ec;
+
+        for (const auto& entry : fs::directory_iterator("/sys/devices/system/node", ec))
+        {
+            const std::string name = entry.path().filename().string();
+            if (!name.starts_with("node")) continue;
+
+            size_t node = 0;
+            const auto [ptr, errc] = std::from_chars(name.data() + 4, name.data() + name.size(), node);
+            if (errc != std::errc{} || ptr != name.data() + name.size()) continue;
+
+            std::ifstream file(entry.path() / "cpulist");
+            std::string cpulist;
+            if (!std::getline(file, cpulist)) continue;
+
+            /* Nodes without any CPUs (e.g. memory-only nodes) are ignored. */
+            if (auto cpus = parse_cpu_list(cpulist); !cpus.empty()) nodes.push_back({ node, std::move(cpus) });
+        }
+
+        return nodes;
+    }
+
+#else
+
+    bool set_thread_affinity(std::jthread&, size_t) noexcept
+    {
+        return true;
+    }
+
+    static std::vector<NumaNode> detect_numa_nodes()
+    {
+        return {};
+    }
+
+#endif
+
+} // namespace gapp::detail
+
+namespace gapp
+{
+    std::vector<NumaNode> numa_nodes()
+    {
+        std::vector<NumaNode> nodes = detail::detect_numa_nodes();
+
+        if (nodes.empty())
+        {
+            std::vector<size_t> cpus(std::max(std::thread::hardware_concurrency(), 1u));
+            std::iota(cpus.begin(), cpus.end(), 0_sz);
+            nodes.push_back({ 0, std::move(cpus) });
+        }
+
+        std::sort(nodes.begin(), nodes.end(), [](const NumaNode& lhs, const NumaNode& rhs) { return lhs.id < rhs.id; });
+
+        return nodes;
+    }
+
+} // namespace gapp
@@ -0,0 +1,48 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#ifndef GAPP_UTILITY_CPU_TOPOLOGY_HPP
+#define GAPP_UTILITY_CPU_TOPOLOGY_HPP
+
+#include <thread>
+#include <vector>
+#include <string_view>
+#include <cstddef>
+
+namespace gapp
+{
+    /** A NUMA node of the machine, and the logical CPUs that belong to it. */
+    struct NumaNode
+    {
+        size_t id;                  /**< The index of the node. */
+        std::vector<size_t> cpus;   /**< The indices of the logical CPUs of the node, in increasing order. */
+    };
+
+    /**
+    * Query the NUMA topology of the machine. The nodes are returned in increasing order of their indices.
+    * Concatenating the CPU lists of the nodes results in a CPU list where the CPUs of each node are next to each
+    * other, which can be used as the CPU affinity of a thread pool to keep the threads of each node together.
+    *
+    * The topology is only detected on Linux and Windows. On other platforms, or if the topology can't be
+    * determined, a single node is returned with all of the hardware threads of the machine.
+    *
+    * @returns The NUMA nodes of the machine. The result always contains at least one node.
+    */
+    std::vector<NumaNode> numa_nodes();
+
+} // namespace gapp
+
+namespace gapp::detail
+{
+    /*
+    * Restrict the thread to run only on the specified logical CPU. Returns false if the affinity of
+    * the thread couldn't be set (e.g. because the CPU doesn't exist). The affinity is not changed on
+    * platforms that don't support it, this function always returns true on these.
+    */
+    bool set_thread_affinity(std::jthread& thread, size_t cpu) noexcept;
+
+    /* Parse a list of CPUs in the format used by Linux (e.g. "0-3,8,10-11"). Returns an empty list if the format is invalid. */
+    std::vector<size_t> parse_cpu_list(std::string_view str);
+
+} // namespace gapp::detail
+
+#endif // !GAPP_UTILITY_CPU_TOPOLOGY_HPP
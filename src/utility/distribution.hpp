@@ -58,13 +58,13 @@ namespace gapp::detail
         template<typename CharT, typename Traits>
         friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const uniform_bool_distribution& dist)
         {
-            os << dist.bit_pool_;
+            return os << dist.bit_pool_;
         }
 
         template<typename CharT, typename Traits>
         friend std::basic_istream<CharT, Traits>& operator>>(std::basic_istream<CharT, Traits>& is, uniform_bool_distribution& dist)
         {
-            is >> dist.bit_pool_;
+            return is >> dist.bit_pool_;
         }
 
     private:
@@ -0,0 +1,182 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#include "file_io.hpp"
+#include "utility.hpp"
+#include <fstream>
+#include <string>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   include <windows.h>
+#else
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <fcntl.h>
+#   include <unistd.h>
+#endif
+
+namespace gapp::detail
+{
+#ifdef _WIN32
+
+    mapped_file::mapped_file(const std::filesystem::path& path)
+    {
+        file_handle_ = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_handle_ == INVALID_HANDLE_VALUE)
+        {
+            file_handle_ = nullptr;
+            GAPP_THROW(std::runtime_error, "Unable to open the file: " + path.string());
+        }
+
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file_handle_, &file_size))
+        {
+            CloseHandle(file_handle_);
+            GAPP_THROW(std::runtime_error, "Unable to get the size of the file: " + path.string());
+        }
+
+        size_ = size_t(file_size.QuadPart);
+        if (size_ == 0) return;
+
+        mapping_handle_ = CreateFileMappingW(file_handle_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping_handle_)
+        {
+            CloseHandle(file_handle_);
+            GAPP_THROW(std::runtime_error, "Unable to map the file: " + path.string());
+        }
+
+        data_ = static_cast<const std::byte*>(MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0));
+        if (!data_)
+        {
+            CloseHandle(mapping_handle_);
+            CloseHandle(file_handle_);
+            GAPP_THROW(std::runtime_error, "Unable to map the file: " + path.string());
+        }
+    }
+
+    mapped_file::~mapped_file() noexcept
+    {
+        if (data_) UnmapViewOfFile(data_);
+        if (mapping_handle_) CloseHandle(mapping_handle_);
+        if (file_handle_) CloseHandle(file_handle_);
+    }
+
+#else
+
+    mapped_file::mapped_file(const std::filesystem::path& path)
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1) GAPP_THROW(std::runtime_error, "Unable to open the file: " + path.string());
+
+        struct stat file_info;
+        if (::fstat(fd, &file_info) == -1)
+        {
+            ::close(fd);
+            GAPP_THROW(std::runtime_error, "Unable to get the size of the file: " + path.string());
+        }
+
+        size_ = size_t(file_info.st_size);
+
+        if (size_ != 0)
+        {
+            void* data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                ::close(fd);
+                GAPP_THROW(std::runtime_error, "Unable to map the file: " + path.string());
+            }
+            data_ = static_cast<const std::byte*>(data);
+        }
+
+        /* The mapping remains valid after the file descriptor is closed. */
+        ::close(fd);
+    }
+
+    mapped_file::~mapped_file() noexcept
+    {
+        if (data_) ::munmap(const_cast<std::byte*>(data_), size_);
+    }
+
+#endif
+
+
+    async_file_writer::async_file_writer() :
+        thread_([this](std::stop_token stop_token) { writer_main(std::move(stop_token)); })
+    {}
+
+    async_file_writer::~async_file_writer() noexcept
+    {
+        thread_.request_stop();
+        thread_.join();
+    }
+
+    void async_file_writer::write(std::filesystem::path path, std::vector<std::byte> contents)
+    {
+        std::unique_lock lock{ lock_ };
+        rethrow_error();
+
+        pending_.emplace(std::move(path), std::move(contents));
+        cv_.notify_all();
+    }
+
+    void async_file_writer::wait()
+    {
+        std::unique_lock lock{ lock_ };
+        cv_.wait(lock, [&] { return !pending_ && !busy_; });
+
+        rethrow_error();
+    }
+
+    void async_file_writer::rethrow_error()
+    {
+        if (error_) std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+
+    void write_file(const std::filesystem::path& path, std::span<const std::byte> contents)
+    {
+        std::filesystem::path temp_path = path;
+        temp_path += ".tmp";
+
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(contents.data()), std::streamsize(contents.size()));
+        file.close();
+
+        if (!file) GAPP_THROW(std::runtime_error, "Unable to write the file: " + temp_path.string());
+
+        std::filesystem::rename(temp_path, path);
+    }
+
+    void async_file_writer::writer_main(std::stop_token stop_token)
+    {
+        std::unique_lock lock{ lock_ };
+
+        while (true)
+        {
+            /* The pending write is still performed after a stop was requested. */
+            cv_.wait(lock, stop_token, [&] { return pending_.has_value(); });
+            if (!pending_) return;
+
+            request_t request = std::move(*pending_);
+            pending_.reset();
+            busy_ = true;
+            lock.unlock();
+
+            std::exception_ptr error;
+            GAPP_TRY { write_file(request.first, request.second); }
+            GAPP_CATCH (...) { error = std::current_exception(); }
+
+            lock.lock();
+            busy_ = false;
+            if (error) error_ = error;
+            cv_.notify_all();
+        }
+    }
+
+} // namespace gapp::detail
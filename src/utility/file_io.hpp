@@ -0,0 +1,91 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#ifndef GAPP_UTILITY_FILE_IO_HPP
+#define GAPP_UTILITY_FILE_IO_HPP
+
+#include <filesystem>
+#include <vector>
+#include <span>
+#include <optional>
+#include <utility>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <cstddef>
+
+namespace gapp::detail
+{
+    /*
+    * Read-only memory mapping of the contents of a file. The file is mapped in its entirety,
+    * and the mapping remains valid for the lifetime of the object.
+    * Throws std::runtime_error if the file can't be opened or mapped.
+    */
+    class mapped_file
+    {
+    public:
+        explicit mapped_file(const std::filesystem::path& path);
+
+        mapped_file(const mapped_file&)            = delete;
+        mapped_file& operator=(const mapped_file&) = delete;
+
+        ~mapped_file() noexcept;
+
+        std::span<const std::byte> data() const noexcept { return { data_, size_ }; }
+
+    private:
+        const std::byte* data_ = nullptr;
+        size_t size_ = 0;
+#ifdef _WIN32
+        void* file_handle_ = nullptr;
+        void* mapping_handle_ = nullptr;
+#endif
+    };
+
+    /*
+    * Replace the contents of a file atomically by writing them to a temporary file first, which
+    * is then renamed. Throws std::runtime_error if the file can't be written.
+    */
+    void write_file(const std::filesystem::path& path, std::span<const std::byte> contents);
+
+    /*
+    * Writes files on a background thread, so the caller doesn't have to wait for the writes
+    * to finish. If a new write is requested before the previous one has been started, only the
+    * latest request is performed. The contents of the files are replaced atomically (a temporary
+    * file is written first, which is then renamed), so a file is never left partially written.
+    *
+    * Errors that occur on the background thread are rethrown on the next call to write() or wait().
+    */
+    class async_file_writer
+    {
+    public:
+        async_file_writer();
+
+        async_file_writer(const async_file_writer&)            = delete;
+        async_file_writer& operator=(const async_file_writer&) = delete;
+
+        /* Finishes the pending write before returning. */
+        ~async_file_writer() noexcept;
+
+        void write(std::filesystem::path path, std::vector<std::byte> contents);
+
+        /* Block until all of the pending writes have finished. */
+        void wait();
+
+    private:
+        using request_t = std::pair<std::filesystem::path, std::vector<std::byte>>;
+
+        void writer_main(std::stop_token stop_token);
+        void rethrow_error();
+
+        std::mutex lock_;
+        std::condition_variable_any cv_;
+        std::optional<request_t> pending_;
+        bool busy_ = false;
+        std::exception_ptr error_;
+        std::jthread thread_;
+    };
+
+} // namespace gapp::detail
+
+#endif // !GAPP_UTILITY_FILE_IO_HPP
@@ -15,10 +15,8 @@
 
 namespace gapp::math
 {
-    bool paretoCompareLess(std::span<const double> lhs, std::span<const double> rhs) noexcept
+    static bool paretoCompareLessImpl(std::span<const double> lhs, std::span<const double> rhs) noexcept
     {
-        GAPP_ASSERT(lhs.size() == rhs.size());
-
         for (size_t i = 0; i < lhs.size(); i++)
         {
             if (floatIsLess(rhs[i], lhs[i])) return false;
@@ -31,10 +29,22 @@ namespace gapp::math
         return false;
     }
 
-    std::int8_t paretoCompare(std::span<const double> lhs, std::span<const double> rhs) noexcept
+    bool paretoCompareLess(std::span<const double> lhs, std::span<const double> rhs) noexcept
     {
         GAPP_ASSERT(lhs.size() == rhs.size());
 
+        switch (lhs.size())
+        {
+            case 2:  return paretoCompareLess<2>(lhs.first<2>(), rhs.first<2>());
+            case 3:  return paretoCompareLess<3>(lhs.first<3>(), rhs.first<3>());
+            case 4:  return paretoCompareLess<4>(lhs.first<4>(), rhs.first<4>());
+            case 8:  return paretoCompareLess<8>(lhs.first<8>(), rhs.first<8>());
+            default: return paretoCompareLessImpl(lhs, rhs);
+        }
+    }
+
+    static std::int8_t paretoCompareImpl(std::span<const double> lhs, std::span<const double> rhs) noexcept
+    {
         std::int8_t lhs_has_lower = 0;
         std::int8_t rhs_has_lower = 0;
 
@@ -56,6 +66,41 @@ namespace gapp::math
         return std::int8_t(rhs_has_lower - lhs_has_lower);
     }
 
+    std::int8_t paretoCompare(std::span<const double> lhs, std::span<const double> rhs) noexcept
+    {
+        GAPP_ASSERT(lhs.size() == rhs.size());
+
+        switch (lhs.size())
+        {
+            case 2:  return paretoCompare<2>(lhs.first<2>(), rhs.first<2>());
+            case 3:  return paretoCompare<3>(lhs.first<3>(), rhs.first<3>());
+            case 4:  return paretoCompare<4>(lhs.first<4>(), rhs.first<4>());
+            case 8:  return paretoCompare<8>(lhs.first<8>(), rhs.first<8>());
+            default: return paretoCompareImpl(lhs, rhs);
+        }
+    }
+
+    bool paretoDominatedByAny(std::span<const double> lhs, std::span<const double> rhs_block) noexcept
+    {
+        GAPP_ASSERT(!lhs.empty() && rhs_block.size() % lhs.size() == 0);
+
+        switch (lhs.size())
+        {
+            case 2:  return paretoDominatedByAny<2>(lhs.first<2>(), rhs_block);
+            case 3:  return paretoDominatedByAny<3>(lhs.first<3>(), rhs_block);
+            case 4:  return paretoDominatedByAny<4>(lhs.first<4>(), rhs_block);
+            case 8:  return paretoDominatedByAny<8>(lhs.first<8>(), rhs_block);
+            default: break;
+        }
+
+        for (size_t row_end = rhs_block.size(); row_end != 0; row_end -= lhs.size())
+        {
+            if (paretoCompareLessImpl(lhs, rhs_block.subspan(row_end - lhs.size(), lhs.size()))) return true;
+        }
+
+        return false;
+    }
+
     double euclideanNorm(std::span<const double> vec) noexcept
     {
         return std::sqrt(std::inner_product(vec.begin(), vec.end(), vec.begin(), 0.0));
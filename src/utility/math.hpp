@@ -139,6 +139,27 @@ namespace gapp::math
 
     /* Pareto comparison for fp ranges. Returns -1 if (lhs < rhs), 1 if (lhs > rhs), and 0 if (lhs == rhs). */
     std::int8_t paretoCompare(std::span<const double> lhs, std::span<const double> rhs) noexcept;
+
+    /*
+    * Pareto comparison kernels for a number of objectives known at compile-time. These return the same results as the
+    * runtime versions, but they compare every element of the ranges without branching, so that the comparisons can be vectorized.
+    * The runtime versions dispatch to these for 2, 3, 4 and 8 objectives.
+    */
+    template<size_t N>
+    bool paretoCompareLess(std::span<const double, N> lhs, std::span<const double, N> rhs) noexcept;
+
+    template<size_t N>
+    std::int8_t paretoCompare(std::span<const double, N> lhs, std::span<const double, N> rhs) noexcept;
+
+    /*
+    * Batched pareto comparison of a single point against a block of points stored contiguously in row-major order (e.g. the
+    * rows of a fitness matrix). Returns true if lhs is dominated by any of the points in the block. The points of the block
+    * are checked in reverse order, starting from the last one.
+    */
+    template<size_t N>
+    bool paretoDominatedByAny(std::span<const double, N> lhs, std::span<const double> rhs_block) noexcept;
+
+    bool paretoDominatedByAny(std::span<const double> lhs, std::span<const double> rhs_block) noexcept;
     
     /* Calculate the length of a vector. */
     double euclideanNorm(std::span<const double> vec) noexcept;
@@ -251,6 +272,69 @@ namespace gapp::math
         return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), floatIsEqual<T>);
     }
 
+    template<size_t N>
+    bool paretoCompareLess(std::span<const double, N> lhs, std::span<const double, N> rhs) noexcept
+    {
+        /* Same as floatIsLess(rhs[i], lhs[i]) and floatIsLessAssumeNotGreater(lhs[i], rhs[i]), but the tolerances are read only once. */
+        const double abs_tol = Tolerances::abs();
+        const double rel_tol = Tolerances::rel(1.0);
+
+        bool rhs_has_lower = false;
+        bool lhs_has_lower = false;
+
+        for (size_t i = 0; i < N; i++)
+        {
+            const double scale_gt = std::max(std::abs(lhs[i]), std::abs(rhs[i]));
+            const double scale_lt = std::abs(rhs[i]);
+
+            const bool is_greater = (scale_gt == inf<double>) ? (rhs[i] < lhs[i]) : ((lhs[i] - rhs[i]) > std::max(rel_tol * scale_gt, abs_tol));
+            const bool is_less    = (scale_lt == inf<double>) ? (lhs[i] < rhs[i]) : ((rhs[i] - lhs[i]) > std::max(rel_tol * scale_lt, abs_tol));
+
+            rhs_has_lower |= is_greater;
+            lhs_has_lower |= is_less;
+        }
+
+        return !rhs_has_lower && lhs_has_lower;
+    }
+
+    template<size_t N>
+    std::int8_t paretoCompare(std::span<const double, N> lhs, std::span<const double, N> rhs) noexcept
+    {
+        /* Same as floatCompare(lhs[i], rhs[i]), but the tolerances are read only once. */
+        const double abs_tol = Tolerances::abs();
+        const double rel_tol = Tolerances::rel(1.0);
+
+        bool rhs_has_lower = false;
+        bool lhs_has_lower = false;
+
+        for (size_t i = 0; i < N; i++)
+        {
+            const double diff = lhs[i] - rhs[i];
+            const double scale = std::min(std::max(std::abs(lhs[i]), std::abs(rhs[i])), large<double>);
+            const double tol = std::max(rel_tol * scale, abs_tol);
+
+            rhs_has_lower |= (diff > tol);
+            lhs_has_lower |= (diff < -tol);
+        }
+
+        if (lhs_has_lower && rhs_has_lower) return 0;
+
+        return std::int8_t(rhs_has_lower - lhs_has_lower);
+    }
+
+    template<size_t N>
+    bool paretoDominatedByAny(std::span<const double, N> lhs, std::span<const double> rhs_block) noexcept
+    {
+        GAPP_ASSERT(rhs_block.size() % N == 0);
+
+        for (size_t row_end = rhs_block.size(); row_end != 0; row_end -= N)
+        {
+            if (paretoCompareLess<N>(lhs, rhs_block.subspan(row_end - N).template first<N>())) return true;
+        }
+
+        return false;
+    }
+
 } // namespace gapp::math
 
 #endif // !GAPP_UTILITY_MATH_HPP
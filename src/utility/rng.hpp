@@ -20,6 +20,10 @@
 #include <array>
 #include <vector>
 #include <span>
+#include <string>
+#include <string_view>
+#include <sstream>
+#include <stdexcept>
 #include <unordered_set>
 #include <bit>
 #include <random>
@@ -214,6 +218,20 @@ namespace gapp::rng
         /** Compare the internal state of 2 generators. @returns True if they are the same. */
         friend constexpr bool operator==(const Xoroshiro128p&, const Xoroshiro128p&) = default;
 
+        /** Write the internal state of the generator to an output stream. */
+        template<typename CharT, typename Traits>
+        friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const Xoroshiro128p& gen)
+        {
+            return os << gen.state_[0] << ' ' << gen.state_[1];
+        }
+
+        /** Read the internal state of the generator from an input stream. */
+        template<typename CharT, typename Traits>
+        friend std::basic_istream<CharT, Traits>& operator>>(std::basic_istream<CharT, Traits>& is, Xoroshiro128p& gen)
+        {
+            return is >> gen.state_[0] >> gen.state_[1];
+        }
+
     private:
         static constexpr state_type seed_sequence(std::uint64_t seed) noexcept
         {
@@ -225,6 +243,116 @@ namespace gapp::rng
     };
 
 
+    /**
+    * Philox4x32-10 counter-based pseudo-random number generator. The numbers are generated by applying
+    * a keyed bijection to a 128 bit counter, so any number of independent streams can be created
+    * from the same key just by using different counter values, without any state shared between them.
+    * This generator is used for the counter-based random number streams (see StreamScope).
+    *
+    * @see
+    *   Salmon, John K., et al. "Parallel random numbers: as easy as 1, 2, 3."
+    *   Proceedings of the 2011 International Conference for High Performance Computing,
+    *   Networking, Storage and Analysis (2011): 1-12.
+    */
+    class Philox4x32
+    {
+    public:
+        using result_type  = std::uint64_t;                /**< The generator generates 64 bit integers. */
+        using key_type     = std::array<std::uint32_t, 2>; /**< The generator uses a 64 bit key. */
+        using counter_type = std::array<std::uint32_t, 4>; /**< The generator uses a 128 bit counter. */
+
+        /**
+        * Create a generator that generates the stream of numbers identified by a key and the
+        * upper 64 bits of the counter. The lower 64 bits of the counter are the position in the stream.
+        *
+        * @param key The key used by the generator.
+        * @param stream The index of the stream for the key.
+        */
+        constexpr Philox4x32(std::uint64_t key, std::uint64_t stream) noexcept :
+            key_{ std::uint32_t(key), std::uint32_t(key >> 32) },
+            counter_{ 0, 0, std::uint32_t(stream), std::uint32_t(stream >> 32) }
+        {}
+
+        /** @returns The next number of the stream. */
+        constexpr result_type operator()() noexcept
+        {
+            if (output_idx_ == output_.size())
+            {
+                output_ = block(counter_, key_);
+                output_idx_ = 0;
+
+                if (++counter_[0] == 0) ++counter_[1];
+            }
+
+            const std::uint64_t lower = output_[output_idx_++];
+            const std::uint64_t upper = output_[output_idx_++];
+
+            return (upper << 32) | lower;
+        }
+
+        /** @returns The result of the Philox4x32-10 bijection for a counter and key. */
+        static constexpr counter_type block(counter_type counter, key_type key) noexcept
+        {
+            constexpr std::uint64_t M0 = 0xD2511F53;
+            constexpr std::uint64_t M1 = 0xCD9E8D57;
+            constexpr std::uint32_t W0 = 0x9E3779B9;
+            constexpr std::uint32_t W1 = 0xBB67AE85;
+
+            for (size_t round = 0; round < 10; round++)
+            {
+                const std::uint64_t product0 = M0 * counter[0];
+                const std::uint64_t product1 = M1 * counter[2];
+
+                counter = { std::uint32_t(product1 >> 32) ^ counter[1] ^ key[0], std::uint32_t(product1),
+                            std::uint32_t(product0 >> 32) ^ counter[3] ^ key[1], std::uint32_t(product0) };
+
+                key[0] += W0;
+                key[1] += W1;
+            }
+
+            return counter;
+        }
+
+        /** @returns The smallest possible value that can be generated. */
+        static constexpr result_type min() noexcept { return std::numeric_limits<result_type>::min(); }
+
+        /** @returns The largest possible value that can be generated. */
+        static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+        /** Compare the internal state of 2 generators. @returns True if they are the same. */
+        friend constexpr bool operator==(const Philox4x32&, const Philox4x32&) = default;
+
+    private:
+        key_type key_;
+        counter_type counter_;
+        counter_type output_{};
+        size_t output_idx_ = output_.size();
+    };
+
+
+    /**
+    * The methods that can be used to generate the random numbers used by the genetic algorithms.
+    */
+    enum class Mode
+    {
+        /**
+        * Each thread uses its own generator, which is seeded from the global seed in the order the threads
+        * first use it. The results of the runs are only reproducible for a fixed number of threads.
+        */
+        PerThread,
+
+        /**
+        * The random numbers used for each candidate in each generation are generated from their own
+        * counter-based streams (see StreamScope), which only depend on the global seed, the generation,
+        * the index of the candidate, and the operation performed on it (e.g. crossover or mutation). The
+        * results of the runs are reproducible regardless of the number of threads used, but generating
+        * the numbers is slightly slower.
+        */
+        CounterBased,
+    };
+
+    class StreamScope;
+
     /**
      * The pseudo-random number generator class used in the library.
      * This class is a simple wrapper around the Xoroshiro128p generator
@@ -243,6 +371,8 @@ namespace gapp::rng
         /** @return The next number of the sequence. Thread-safe. */
         result_type operator()() const noexcept
         {
+            if (generator_.stream) [[unlikely]] return std::invoke(*generator_.stream);
+
             return std::invoke(generator_.instance);
         }
 
@@ -255,6 +385,7 @@ namespace gapp::rng
         {
             std::scoped_lock _{ tls_generators_->lock };
             global_generator_.seed(seed);
+            global_seed_ = seed;
 
             for (RegisteredGenerator* generator : tls_generators_->list)
             {
@@ -266,6 +397,36 @@ namespace gapp::rng
             }
         }
 
+        /**
+        * @returns The state of the generator used by the calling thread, including the states
+        *   of the distributions that use it, in a serialized form. Used for checkpointing.
+        */
+        static std::string thread_state()
+        {
+            std::ostringstream state;
+            state << generator_.instance << ' '
+                  << generator_.bool_distribution << ' '
+                  << generator_.normal_distribution << ' '
+                  << generator_.poisson_distribution;
+
+            return std::move(state).str();
+        }
+
+        /**
+        * Restore the state of the generator used by the calling thread from a value previously
+        * returned by thread_state(). This function shouldn't be called while a GA is running.
+        */
+        static void thread_state(std::string_view serialized_state)
+        {
+            std::istringstream state{ std::string(serialized_state) };
+            state >> generator_.instance
+                  >> generator_.bool_distribution
+                  >> generator_.normal_distribution
+                  >> generator_.poisson_distribution;
+
+            if (!state) GAPP_THROW(std::invalid_argument, "Invalid serialized generator state.");
+        }
+
         /** @returns The smallest possible value that can be generated. */
         static constexpr result_type min() noexcept { return Xoroshiro128p::min(); }
 
@@ -289,6 +450,7 @@ namespace gapp::rng
             }
 
             Xoroshiro128p instance{ 0 };
+            Philox4x32* stream = nullptr;
 
             detail::uniform_bool_distribution bool_distribution;
             std::normal_distribution<double> normal_distribution;
@@ -305,7 +467,13 @@ namespace gapp::rng
         template<std::integral T> friend T randomPoisson(double);
         template<std::floating_point T> friend T randomNormal(T, T);
 
+        friend class StreamScope;
+        friend void mode(Mode) noexcept;
+        friend Mode mode() noexcept;
+
         GAPP_API inline static constinit Xoroshiro128p global_generator_{ GAPP_SEED };
+        GAPP_API inline static constinit std::uint64_t global_seed_ = GAPP_SEED;
+        GAPP_API inline static constinit Mode mode_ = Mode::PerThread;
         GAPP_API inline static detail::Indestructible<GeneratorList> tls_generators_;
         alignas(128) inline static thread_local RegisteredGenerator generator_;
     };
@@ -314,6 +482,124 @@ namespace gapp::rng
     /** The global pseudo-random number generator instance used in the algorithms. */
     inline constexpr ConcurrentXoroshiro128p prng;
 
+
+    /**
+    * Set the method used to generate the random numbers used by the genetic algorithms.
+    * The default mode is Mode::PerThread.
+    *
+    * @note This function is not thread-safe and shouldn't be called while a genetic algorithm is running.
+    *
+    * @param mode The random number generation mode to use.
+    */
+    inline void mode(Mode mode) noexcept { ConcurrentXoroshiro128p::mode_ = mode; }
+
+    /** @returns The method used to generate the random numbers used by the genetic algorithms. */
+    inline Mode mode() noexcept { return ConcurrentXoroshiro128p::mode_; }
+
+    /**
+    * This class can be used to set the random number generation mode temporarily.
+    * The mode is set when an instance of the class is created, and it is reset to
+    * its previous value when the instance is destroyed.
+    *
+    * @warning
+    *   Creating an instance of this class modifies the global random number generation
+    *   mode, so it shouldn't be instantiated while a genetic algorithm is running.
+    */
+    class [[nodiscard]] ScopedMode
+    {
+    public:
+        /**
+        * Create an instance of the class, setting a new random number generation mode.
+        *
+        * @param mode The random number generation mode to use.
+        */
+        explicit ScopedMode(Mode mode) noexcept :
+            old_mode_(rng::mode())
+        {
+            rng::mode(mode);
+        }
+
+        /** Reset the random number generation mode to its previous value. */
+        ~ScopedMode() noexcept { rng::mode(old_mode_); }
+
+        ScopedMode(const ScopedMode&)            = delete;
+        ScopedMode(ScopedMode&&)                 = delete;
+        ScopedMode& operator=(const ScopedMode&) = delete;
+        ScopedMode& operator=(ScopedMode&&)      = delete;
+
+    private:
+        Mode old_mode_;
+    };
+
+
+    /**
+    * The random numbers generated by the calling thread during the lifetime of this object are generated from a
+    * counter-based stream instead of the generator of the thread, if the counter-based mode is used (see mode()).
+    * The stream is identified by the global seed and the parameters of the constructor, and it doesn't depend on
+    * which thread uses it, or on the numbers generated before it. This object does nothing in the per-thread mode.
+    *
+    * The genetic algorithms use these streams for every candidate in the genetic operators and the fitness
+    * evaluations, which makes the results of the runs independent of the number of threads used.
+    * Nested scopes are allowed, the previous stream of the thread is restored when a scope ends.
+    */
+    class [[nodiscard]] StreamScope
+    {
+    public:
+        /**
+        * Create a counter-based random number stream for the calling thread.
+        *
+        * @param stream An identifier of the user of the streams (e.g. the index of an island in an island model).
+        * @param generation The generation in which the stream is used.
+        * @param index The index of the candidate the stream is used for.
+        * @param purpose An identifier of the operation the stream is used for (e.g. crossover or mutation).
+        */
+        StreamScope(std::uint64_t stream, std::uint64_t generation, std::uint64_t index, std::uint64_t purpose) noexcept :
+            active_(ConcurrentXoroshiro128p::mode_ == Mode::CounterBased)
+        {
+            if (!active_) return;
+
+            auto& generator = ConcurrentXoroshiro128p::generator_;
+
+            /* The distributions cache some of the numbers generated earlier, they are reset so they only use the numbers of the stream. */
+            prev_bool_distribution_ = std::exchange(generator.bool_distribution, {});
+            prev_normal_distribution_ = std::exchange(generator.normal_distribution, {});
+            prev_poisson_distribution_ = generator.poisson_distribution;
+            generator.poisson_distribution.reset();
+
+            Splitmix64 key_gen{ ConcurrentXoroshiro128p::global_seed_ };
+            key_gen.seed(key_gen() ^ stream);
+            key_gen.seed(key_gen() ^ purpose);
+
+            generator_ = Philox4x32{ key_gen(), (generation << 32) ^ index };
+            prev_stream_ = std::exchange(generator.stream, &generator_);
+        }
+
+        StreamScope(const StreamScope&)            = delete;
+        StreamScope& operator=(const StreamScope&) = delete;
+
+        ~StreamScope() noexcept
+        {
+            if (!active_) return;
+
+            auto& generator = ConcurrentXoroshiro128p::generator_;
+
+            generator.stream = prev_stream_;
+            generator.bool_distribution = prev_bool_distribution_;
+            generator.normal_distribution = prev_normal_distribution_;
+            generator.poisson_distribution = prev_poisson_distribution_;
+        }
+
+    private:
+        Philox4x32 generator_{ 0, 0 };
+        Philox4x32* prev_stream_ = nullptr;
+
+        detail::uniform_bool_distribution prev_bool_distribution_;
+        std::normal_distribution<double> prev_normal_distribution_;
+        std::poisson_distribution<std::uint64_t> prev_poisson_distribution_;
+
+        bool active_;
+    };
+
 } // namespace gapp::rng
 
 
@@ -0,0 +1,150 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#ifndef GAPP_UTILITY_SERIALIZATION_HPP
+#define GAPP_UTILITY_SERIALIZATION_HPP
+
+#include "utility.hpp"
+#include <vector>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <stdexcept>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace gapp::detail
+{
+    /*
+    * The alignment of the arrays in the serialized data. The arrays are aligned so that
+    * they can be accessed in place when reading the data (e.g. from a memory mapped file).
+    */
+    inline constexpr size_t SERIALIZED_ARRAY_ALIGNMENT = 8;
+
+    /*
+    * Simple binary serializer for trivially copyable types. The values are written in
+    * the native byte order without any type information, so the data can only be read
+    * back by a binary_reader reading the same sequence of types.
+    */
+    class binary_writer
+    {
+    public:
+        template<typename T>
+        requires std::is_trivially_copyable_v<T>
+        void write(const T& value)
+        {
+            const auto bytes = std::as_bytes(std::span{ &value, 1 });
+            data_.insert(data_.end(), bytes.begin(), bytes.end());
+        }
+
+        /* The arrays are written as their size followed by the elements. */
+        template<typename T>
+        requires std::is_trivially_copyable_v<T>
+        void write_array(std::span<const T> values)
+        {
+            static_assert(alignof(T) <= SERIALIZED_ARRAY_ALIGNMENT);
+
+            write<std::uint64_t>(values.size());
+            data_.resize(align_up(data_.size()));
+
+            const auto bytes = std::as_bytes(values);
+            data_.insert(data_.end(), bytes.begin(), bytes.end());
+        }
+
+        template<typename T>
+        requires std::is_trivially_copyable_v<T>
+        void write_array(const std::vector<T>& values)
+        {
+            write_array(std::span<const T>(values));
+        }
+
+        void write_string(std::string_view str)
+        {
+            write_array(std::span<const char>(str));
+        }
+
+        const std::vector<std::byte>& data() const noexcept { return data_; }
+
+        std::vector<std::byte> release() noexcept { return std::move(data_); }
+
+    private:
+        static constexpr size_t align_up(size_t offset) noexcept
+        {
+            return (offset + SERIALIZED_ARRAY_ALIGNMENT - 1) / SERIALIZED_ARRAY_ALIGNMENT * SERIALIZED_ARRAY_ALIGNMENT;
+        }
+
+        std::vector<std::byte> data_;
+    };
+
+    /*
+    * Reads the data written by a binary_writer. The arrays are not copied, they are returned as
+    * views into the underlying data, which must be aligned to SERIALIZED_ARRAY_ALIGNMENT and must
+    * outlive the views. Throws std::runtime_error if the data ends unexpectedly.
+    */
+    class binary_reader
+    {
+    public:
+        explicit binary_reader(std::span<const std::byte> data) noexcept :
+            data_(data)
+        {}
+
+        template<typename T>
+        requires std::is_trivially_copyable_v<T>
+        T read()
+        {
+            require(sizeof(T));
+
+            T value;
+            std::memcpy(std::addressof(value), data_.data() + pos_, sizeof(T));
+            pos_ += sizeof(T);
+
+            return value;
+        }
+
+        template<typename T>
+        requires std::is_trivially_copyable_v<T>
+        std::span<const T> read_array()
+        {
+            static_assert(alignof(T) <= SERIALIZED_ARRAY_ALIGNMENT);
+
+            const auto size = read<std::uint64_t>();
+            require(align_up(pos_) - pos_);
+            pos_ = align_up(pos_);
+
+            if (size > remaining() / sizeof(T)) GAPP_THROW(std::runtime_error, "Unexpected end of the serialized data.");
+
+            const auto* first = data_.data() + pos_;
+            GAPP_ASSERT(reinterpret_cast<std::uintptr_t>(first) % alignof(T) == 0, "Misaligned serialized data.");
+            pos_ += size * sizeof(T);
+
+            return { reinterpret_cast<const T*>(first), size_t(size) };
+        }
+
+        std::string_view read_string()
+        {
+            const auto chars = read_array<char>();
+            return { chars.data(), chars.size() };
+        }
+
+        size_t remaining() const noexcept { return data_.size() - pos_; }
+
+        bool at_end() const noexcept { return pos_ == data_.size(); }
+
+    private:
+        static constexpr size_t align_up(size_t offset) noexcept
+        {
+            return (offset + SERIALIZED_ARRAY_ALIGNMENT - 1) / SERIALIZED_ARRAY_ALIGNMENT * SERIALIZED_ARRAY_ALIGNMENT;
+        }
+
+        void require(size_t size) const
+        {
+            if (size > remaining()) GAPP_THROW(std::runtime_error, "Unexpected end of the serialized data.");
+        }
+
+        std::span<const std::byte> data_;
+        size_t pos_ = 0;
+    };
+
+} // namespace gapp::detail
+
+#endif // !GAPP_UTILITY_SERIALIZATION_HPP
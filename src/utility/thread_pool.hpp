@@ -3,87 +3,202 @@
 #ifndef GAPP_UTILITY_THREAD_POOL_HPP
 #define GAPP_UTILITY_THREAD_POOL_HPP
 
-#include "concurrent_queue.hpp"
+#include "work_stealing_deque.hpp"
+#include "cpu_topology.hpp"
 #include "algorithm.hpp"
 #include "functional.hpp"
 #include "iterators.hpp"
 #include "latch.hpp"
+#include "small_vector.hpp"
 #include "utility.hpp"
 #include <algorithm>
 #include <type_traits>
 #include <concepts>
 #include <thread>
 #include <atomic>
-#include <future>
 #include <functional>
 #include <iterator>
+#include <memory>
 #include <exception>
 #include <stdexcept>
+#include <tuple>
+#include <vector>
 #include <utility>
+#include <cstdint>
 #include <cstddef>
 
+namespace gapp
+{
+    /**
+    * The strategy used by the idle threads of a thread pool to wait for new work. An idle thread
+    * first checks for new work in a loop for a while (spinning), then repeatedly yields its time
+    * slice, and finally blocks until new work is submitted to the pool. \n
+    * Spinning keeps the threads responsive between the back-to-back parallel parts of a run,
+    * since waking up a blocked thread is relatively slow, while the blocking makes sure that the
+    * threads of an idle thread pool don't keep using the CPU.
+    *
+    * @note The threads never spin on machines with a single hardware thread, since the spinning
+    *   threads would only delay the thread that would submit the new work.
+    */
+    struct WaitPolicy
+    {
+        size_t spin_count  = 2048;  /**< The number of times an idle thread checks for new work with a pause instruction in between, before it starts yielding. */
+        size_t yield_count = 16;    /**< The number of times an idle thread yields its time slice when there is no new work, before blocking. */
+    };
+
+} // namespace gapp
+
 namespace gapp::detail
 {
+    /**
+    * The possible strategies used to distribute the iterations of a parallel loop
+    * between the threads of the thread pool.
+    */
+    enum class schedule_type
+    {
+        static_blocks, /**< The iterations are split into equal sized blocks up front, one for each thread. */
+        dynamic,       /**< The threads repeatedly claim fixed size chunks of the remaining iterations. */
+        guided,        /**< Same as dynamic, but the size of the chunks decreases as the loop progresses. */
+    };
+
     class thread_pool
     {
     public:
         template<typename F, typename Iter>
         void execute_loop(Iter first, Iter last, size_t block_size, F&& unary_op)
         {
-            if (first == last) return;
+            execute_loop(first, last, block_size, schedule_type::static_blocks, std::forward<F>(unary_op));
+        }
 
-            std::exception_ptr exception;
-            std::atomic<bool> has_exception;
+        template<typename F, typename Iter>
+        void execute_loop(Iter first, Iter last, size_t block_size, schedule_type schedule, F&& unary_op)
+        {
+            GAPP_ASSERT(block_size > 0);
 
-            [[maybe_unused]] const auto thread_guard = [&]() noexcept
-            {
-                if (!has_exception.exchange(true, std::memory_order_relaxed))
-                    exception = std::current_exception();
-            };
+            if (first == last) return;
 
             const size_t iterations  = std::distance(first, last);
             const size_t block_count = iterations / block_size + bool(iterations % block_size);
-            const size_t task_count  = detail::min(workers_.size() + workers_.empty(), iterations, block_count);
-            const size_t step_size   = iterations / task_count;
-            const size_t remainder   = iterations % task_count;
+            const size_t task_count  = serial_execution_ ? 1 : detail::min(workers_.size() + workers_.empty(), iterations, block_count);
 
-            detail::latch remaining_tasks(task_count - 1);
+            if (schedule == schedule_type::static_blocks || !std::random_access_iterator<Iter>)
+            {
+                const size_t step_size = iterations / task_count;
+                const size_t remainder = iterations % task_count;
 
-            for (size_t i = 0; i < task_count - 1; i++)
+                small_vector<Iter> block_bounds(task_count + 1, first);
+                for (size_t i = 0; i < task_count; i++)
+                {
+                    block_bounds[i + 1] = std::next(block_bounds[i], step_size + (i < remainder));
+                }
+
+                execute_tasks(task_count, [&](size_t block_idx)
+                {
+                    Iter block_first = block_bounds[block_idx];
+                    Iter block_last  = block_bounds[block_idx + 1];
+
+                    while (block_first != block_last) { std::invoke(unary_op, *block_first++); }
+                });
+            }
+            else if constexpr (std::random_access_iterator<Iter>)
             {
-                Iter block_last  = std::next(first, step_size + (i < remainder));
-                Iter block_first = std::exchange(first, block_last);
+                /* The chunks are claimed from a shared cursor by the threads as they become free,
+                 * so the load is balanced even if the cost of each iteration is very different. */
+                std::atomic<size_t> cursor = 0;
 
-                auto task = [&, block_first, block_last]() mutable noexcept
+                const auto claim_chunk = [&]() noexcept -> std::pair<size_t, size_t>
                 {
-                    GAPP_TRY { while (block_first != block_last) { std::invoke(unary_op, *block_first++); } }
-                    GAPP_CATCH (...) { thread_guard(); }
-                    remaining_tasks.count_down();
+                    if (schedule == schedule_type::dynamic)
+                    {
+                        const size_t chunk_first = cursor.fetch_add(block_size, std::memory_order_relaxed);
+                        if (chunk_first >= iterations) return { iterations, iterations };
+                        return { chunk_first, std::min(chunk_first + block_size, iterations) };
+                    }
+
+                    size_t chunk_first = cursor.load(std::memory_order_relaxed);
+                    while (chunk_first < iterations)
+                    {
+                        const size_t remaining  = iterations - chunk_first;
+                        const size_t chunk_size = std::min(std::max(block_size, remaining / (2 * task_count)), remaining);
+                        if (cursor.compare_exchange_weak(chunk_first, chunk_first + chunk_size, std::memory_order_relaxed))
+                        {
+                            return { chunk_first, chunk_first + chunk_size };
+                        }
+                    }
+                    return { iterations, iterations };
                 };
 
-                bool success = scheduled_worker_queue().emplace(std::move(task));
-                if (!success) GAPP_THROW(std::runtime_error, "Attempting to submit a task to a stopped thread pool.");
+                execute_tasks(task_count, [&](size_t)
+                {
+                    for (auto [chunk_first, chunk_last] = claim_chunk(); chunk_first != chunk_last; std::tie(chunk_first, chunk_last) = claim_chunk())
+                    {
+                        for (size_t i = chunk_first; i != chunk_last; i++) { std::invoke(unary_op, first[i]); }
+                    }
+                });
             }
+        }
 
-            while (first != last) { std::invoke(unary_op, *first++); }
+        /*
+        * The thread pool used by the parallel loops started from the calling thread. This is the pool set by the innermost
+        * execution_scope of the thread if there is one, or the pool the thread belongs to if it's a worker thread of a pool.
+        * Returns nullptr if neither applies.
+        */
+        static thread_pool* local_pool() noexcept
+        {
+            if (scoped_pool_) return scoped_pool_;
+            return current_worker_ ? current_worker_->pool : nullptr;
+        }
 
-            if (auto* local_queue = local_worker_queue(); !local_queue)
-            {
-                remaining_tasks.wait();
-            }
-            else while (true)
-            {
-                while (!local_queue->empty()) { std::invoke(*local_queue->take()); }
-                if (remaining_tasks.try_wait()) break;
-                std::this_thread::yield();
-            }
+        void reset_scheduler(size_t turn = 0)
+        {
+            turn_.store(turn, std::memory_order_relaxed);
+        }
 
-            if (has_exception.load(std::memory_order_relaxed)) std::rethrow_exception(exception);
+        /* The state of the round-robin scheduler used to assign the tasks submitted from outside of the pool to the workers. */
+        size_t scheduler_state() const noexcept
+        {
+            return turn_.load(std::memory_order_relaxed);
+        }
+
+        /*
+        * Invoke f exactly once on each thread of the pool, with the index of the thread as its argument.
+        * The calling thread is included with the index thread_count() - 1. This doesn't modify the state
+        * of the scheduler. Can't be called from the worker threads of the pool.
+        */
+        template<typename F>
+        requires std::invocable<F&, size_t>
+        void execute_on_each_thread(F&& f)
+        {
+            GAPP_ASSERT(!local_worker(), "Can't be called from a worker thread of the pool.");
+
+            execute_tasks(workers_.size() + 1, std::forward<F>(f), /* one_per_worker = */ true);
+        }
+
+        /*
+        * Execute one of the tasks available to the calling thread if it's a worker thread of the pool (e.g. a task of a nested
+        * parallel loop started by another thread). Returns false if no task was executed. This can be used by the threads that
+        * are waiting for another thread of the pool to make progress while they are waiting.
+        */
+        bool try_execute_task() noexcept
+        {
+            worker_t* this_worker = local_worker();
+            if (!this_worker) return false;
+
+            task_t* task = find_task(*this_worker);
+            if (task) std::invoke(task->func, task->idx);
+
+            return task;
         }
 
-        void reset_scheduler()
+        void wait_policy(WaitPolicy policy) noexcept
         {
-            turn_.store(0, std::memory_order_relaxed);
+            spin_count_.store(policy.spin_count, std::memory_order_relaxed);
+            yield_count_.store(policy.yield_count, std::memory_order_relaxed);
+        }
+
+        WaitPolicy wait_policy() const noexcept
+        {
+            return { spin_count_.load(std::memory_order_relaxed), yield_count_.load(std::memory_order_relaxed) };
         }
 
         void thread_count(size_t count)
@@ -92,6 +207,34 @@ namespace gapp::detail
             if (count == thread_count()) return;
             stop();
             workers_ = std::vector<worker_t>(count - 1);
+            start();
+        }
+
+        /*
+        * Pin each worker thread of the pool to a single CPU, with the i-th worker running on cpus[i % cpus.size()].
+        * The calling thread of the parallel loops isn't pinned. An empty list removes the affinity of the workers.
+        * Throws std::invalid_argument and leaves the workers unpinned if a thread couldn't be pinned to its CPU.
+        */
+        void cpu_affinity(std::vector<size_t> cpus)
+        {
+            reset_scheduler();
+            stop();
+            workers_ = std::vector<worker_t>(workers_.size());
+            cpu_affinity_ = std::move(cpus);
+
+            if (!start())
+            {
+                stop();
+                workers_ = std::vector<worker_t>(workers_.size());
+                cpu_affinity_.clear();
+                start();
+                GAPP_THROW(std::invalid_argument, "Unable to set the CPU affinity of the threads of the thread pool.");
+            }
+        }
+
+        const std::vector<size_t>& cpu_affinity() const noexcept
+        {
+            return cpu_affinity_;
         }
 
         size_t thread_count() const noexcept
@@ -101,7 +244,14 @@ namespace gapp::detail
 
         ~thread_pool() noexcept { stop(); }
 
-        thread_pool() = default;
+        thread_pool() { start(); }
+
+        /* The calling thread of a parallel loop is included in the thread count. */
+        explicit thread_pool(size_t thread_count) :
+            workers_(std::max(thread_count, 1_sz) - 1)
+        {
+            start();
+        }
 
         thread_pool(const thread_pool&)            = delete;
         thread_pool(thread_pool&&)                 = delete;
@@ -110,53 +260,362 @@ namespace gapp::detail
         thread_pool& operator=(thread_pool&&)      = delete;
 
     private:
-        using task_t = detail::move_only_function<void()>;
+        /* The tasks are owned by the thread submitting them, and they must outlive their execution. */
+        struct task_t
+        {
+            detail::function_ref<void(size_t)> func;
+            size_t idx = 0;
+            task_t* next = nullptr;
+        };
 
-        struct alignas(128) worker_t
+        /* Lock-free multi-producer, single-consumer list of the tasks assigned to a specific worker. */
+        class task_inbox
         {
-            static void worker_main(detail::concurrent_queue<task_t>& task_queue) noexcept
+        public:
+            void push(task_t* task) noexcept
             {
-                while (true)
+                task->next = head_.load(std::memory_order_relaxed);
+                while (!head_.compare_exchange_weak(task->next, task, std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            task_t* take() noexcept
+            {
+                if (!pending_ && head_.load(std::memory_order_relaxed))
                 {
-                    auto task = task_queue.take();
-                    if (!task.has_value()) return;
-                    std::invoke(std::move(*task));
+                    /* The tasks were pushed in LIFO order, reverse them so they are executed in the order they were submitted. */
+                    for (task_t* task = head_.exchange(nullptr, std::memory_order_acquire); task;)
+                    {
+                        pending_ = std::exchange(task, std::exchange(task->next, pending_));
+                    }
                 }
+                return pending_ ? std::exchange(pending_, pending_->next) : nullptr;
+            }
+
+            bool empty() const noexcept
+            {
+                return !pending_ && !head_.load(std::memory_order_relaxed);
             }
 
-            detail::concurrent_queue<task_t> task_queue;
-            std::jthread thread{ worker_main, std::ref(task_queue) };
+        private:
+            std::atomic<task_t*> head_ = nullptr;
+            task_t* pending_ = nullptr;
         };
 
-        auto scheduled_worker_queue() noexcept -> detail::concurrent_queue<task_t>&
+        struct alignas(128) worker_t
+        {
+            void notify() noexcept
+            {
+                signal.fetch_add(1, std::memory_order_release);
+
+                /* The worker is only blocked in park() if it's marked as sleeping, there is no need to wake it up otherwise. */
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (sleeping.load(std::memory_order_relaxed)) signal.notify_one();
+            }
+
+            size_t random_victim() noexcept
+            {
+                victim_seed ^= victim_seed << 13;
+                victim_seed ^= victim_seed >> 7;
+                victim_seed ^= victim_seed << 17;
+                return size_t(victim_seed);
+            }
+
+            /* Tasks submitted from outside of the pool are pinned to the worker they were assigned to, which
+             * keeps the thread-local states (e.g. the random number generators) used by each task deterministic. */
+            task_inbox pinned_tasks;
+            /* Tasks submitted by the worker itself (i.e. nested parallel loops), these can be stolen by the other workers. */
+            detail::work_stealing_deque<task_t*> local_tasks;
+
+            std::atomic<std::uint32_t> signal = 0;
+            std::atomic<bool> sleeping = false;
+            std::uint64_t victim_seed = 0;
+
+            thread_pool* pool = nullptr;
+            std::jthread thread;
+        };
+
+        template<typename F>
+        void execute_tasks(size_t task_count, F&& task_fn, bool one_per_worker = false)
+        {
+            GAPP_ASSERT(task_count > 0);
+
+            std::exception_ptr exception;
+            std::atomic<bool> has_exception;
+            detail::latch remaining_tasks(task_count - 1);
+
+            auto run_task = [&](size_t idx) noexcept
+            {
+                GAPP_TRY { std::invoke(task_fn, idx); }
+                GAPP_CATCH (...)
+                {
+                    if (!has_exception.exchange(true, std::memory_order_relaxed))
+                        exception = std::current_exception();
+                }
+            };
+
+            auto run_submitted_task = [&](size_t idx) noexcept
+            {
+                run_task(idx);
+                remaining_tasks.count_down();
+            };
+
+            if (task_count > 1 && stopped_.load(std::memory_order_relaxed))
+            {
+                GAPP_THROW(std::runtime_error, "Attempting to submit a task to a stopped thread pool.");
+            }
+
+            small_vector<task_t> tasks(task_count - 1);
+            for (size_t i = 0; i < tasks.size(); i++)
+            {
+                tasks[i].func = run_submitted_task;
+                tasks[i].idx = i;
+                one_per_worker ? submit_to(workers_[i], &tasks[i]) : submit(&tasks[i]);
+            }
+
+            run_task(task_count - 1);
+            wait_for(remaining_tasks);
+
+            if (has_exception.load(std::memory_order_relaxed)) std::rethrow_exception(exception);
+        }
+
+        void submit(task_t* task)
+        {
+            if (worker_t* this_worker = local_worker(); this_worker)
+            {
+                this_worker->local_tasks.push(task);
+                notify_idle_worker();
+            }
+            else
+            {
+                submit_to(scheduled_worker(), task);
+            }
+        }
+
+        void submit_to(worker_t& worker, task_t* task) noexcept
+        {
+            worker.pinned_tasks.push(task);
+            worker.notify();
+        }
+
+        void wait_for(const detail::latch& remaining_tasks) noexcept
+        {
+            worker_t* this_worker = local_worker();
+
+            if (!this_worker) return remaining_tasks.wait();
+
+            /* Keep executing the tasks available to the worker instead of blocking,
+             * as the tasks we are waiting for might depend on these. */
+            while (!remaining_tasks.try_wait())
+            {
+                if (task_t* task = find_task(*this_worker)) { std::invoke(task->func, task->idx); }
+                else std::this_thread::yield();
+            }
+        }
+
+        task_t* find_task(worker_t& worker) noexcept
+        {
+            if (task_t* task = worker.pinned_tasks.take()) return task;
+            if (auto task = worker.local_tasks.pop()) return *task;
+
+            return steal_task(worker);
+        }
+
+        task_t* steal_task(worker_t& thief) noexcept
+        {
+            const size_t worker_count = workers_.size();
+            size_t victim = thief.random_victim() % worker_count;
+
+            for (size_t i = 0; i < worker_count; i++, detail::increment_mod(victim, worker_count))
+            {
+                if (auto task = workers_[victim].local_tasks.steal()) return *task;
+            }
+            return nullptr;
+        }
+
+        bool has_stealable_task() const noexcept
+        {
+            return std::any_of(workers_.begin(), workers_.end(), [](const worker_t& worker) { return !worker.local_tasks.empty(); });
+        }
+
+        void worker_main(worker_t& worker) noexcept
+        {
+            current_worker_ = &worker;
+
+            while (true)
+            {
+                if (task_t* task = find_task(worker)) { std::invoke(task->func, task->idx); continue; }
+                if (wait_for_work(worker)) continue;
+                if (!park(worker)) return;
+            }
+        }
+
+        bool has_work(const worker_t& worker) const noexcept
+        {
+            return !worker.pinned_tasks.empty() || has_stealable_task();
+        }
+
+        /* Spin and then yield until there is new work available to the worker. Returns false if there wasn't any, or if the pool was stopped. */
+        bool wait_for_work(const worker_t& worker) const noexcept
+        {
+            const size_t spin_count = is_multicore_ ? spin_count_.load(std::memory_order_relaxed) : 0;
+            const size_t yield_count = yield_count_.load(std::memory_order_relaxed);
+
+            for (size_t i = 0; i < spin_count; i++)
+            {
+                if (stopped_.load(std::memory_order_relaxed)) return false;
+                if (has_work(worker)) return true;
+                GAPP_PAUSE();
+            }
+            for (size_t i = 0; i < yield_count; i++)
+            {
+                if (stopped_.load(std::memory_order_relaxed)) return false;
+                if (has_work(worker)) return true;
+                std::this_thread::yield();
+            }
+            return false;
+        }
+
+        /* Block the worker until it is notified. Returns false if the pool was stopped. */
+        bool park(worker_t& worker) noexcept
+        {
+            const std::uint32_t signal = worker.signal.load(std::memory_order_acquire);
+
+            worker.sleeping.store(true, std::memory_order_seq_cst);
+            idle_workers_.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            /* Check for any tasks submitted before we were marked as idle. */
+            if (!has_work(worker) && !stopped_.load(std::memory_order_acquire)) worker.signal.wait(signal, std::memory_order_acquire);
+
+            idle_workers_.fetch_sub(1, std::memory_order_relaxed);
+            worker.sleeping.store(false, std::memory_order_relaxed);
+
+            return !stopped_.load(std::memory_order_acquire);
+        }
+
+        void notify_idle_worker() noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (idle_workers_.load(std::memory_order_relaxed) == 0) return;
+
+            auto idle_worker = std::find_if(workers_.begin(), workers_.end(), [](const worker_t& worker)
+            {
+                return worker.sleeping.load(std::memory_order_relaxed);
+            });
+            if (idle_worker != workers_.end()) idle_worker->notify();
+        }
+
+        worker_t& scheduled_worker() noexcept
         {
             const size_t current_turn   = turn_.fetch_add(1, std::memory_order_relaxed);
             const size_t current_worker = current_turn % workers_.size();
 
-            return workers_[current_worker].task_queue;
+            return workers_[current_worker];
         }
 
-        auto local_worker_queue() noexcept -> detail::concurrent_queue<task_t>*
+        worker_t* local_worker() noexcept
         {
-            for (worker_t& worker : workers_)
+            return (current_worker_ && current_worker_->pool == this) ? current_worker_ : nullptr;
+        }
+
+        /* Returns false if any of the workers couldn't be pinned to its CPU. */
+        bool start()
+        {
+            bool pinned = true;
+
+            stopped_.store(false, std::memory_order_relaxed);
+            for (size_t i = 0; i < workers_.size(); i++)
             {
-                if (worker.thread.get_id() == std::this_thread::get_id()) { return &worker.task_queue; }
+                workers_[i].victim_seed = i + 1;
+                workers_[i].pool = this;
+                workers_[i].thread = std::jthread([this, &worker = workers_[i]] { worker_main(worker); });
+
+                if (!cpu_affinity_.empty())
+                {
+                    pinned &= detail::set_thread_affinity(workers_[i].thread, cpu_affinity_[i % cpu_affinity_.size()]);
+                }
             }
-            return nullptr;
+
+            return pinned;
         }
 
         void stop() noexcept
         {
-            for (worker_t& worker : workers_) { worker.task_queue.close(); }
+            stopped_.store(true, std::memory_order_release);
+            for (worker_t& worker : workers_) { worker.notify(); }
+            for (worker_t& worker : workers_) { if (worker.thread.joinable()) worker.thread.join(); }
         }
 
         std::vector<worker_t> workers_{ std::max(std::thread::hardware_concurrency(), 1u) - 1u };
         std::atomic<size_t> turn_;
+        std::atomic<size_t> idle_workers_;
+        std::atomic<bool> stopped_;
+        std::vector<size_t> cpu_affinity_;
+
+        std::atomic<size_t> spin_count_ = WaitPolicy{}.spin_count;
+        std::atomic<size_t> yield_count_ = WaitPolicy{}.yield_count;
+        const bool is_multicore_ = std::thread::hardware_concurrency() > 1;
+
+        inline static thread_local worker_t* current_worker_ = nullptr;
+        inline static thread_local bool serial_execution_ = false;
+        inline static thread_local thread_pool* scoped_pool_ = nullptr;
+
+        friend class serial_execution_scope;
+        friend class execution_scope;
     };
 
     struct execution_context
     {
         GAPP_API inline static thread_pool global_thread_pool;
+
+        /* Return the thread pool used by the parallel loops started from the calling thread. */
+        static thread_pool& current() noexcept
+        {
+            thread_pool* local_pool = thread_pool::local_pool();
+            return local_pool ? *local_pool : global_thread_pool;
+        }
+    };
+
+    /*
+    * The parallel loops started from the current thread are executed serially on the
+    * current thread during the lifetime of this object, instead of being distributed
+    * between the threads of the thread pool.
+    */
+    class [[nodiscard]] serial_execution_scope
+    {
+    public:
+        serial_execution_scope() noexcept :
+            prev_(std::exchange(thread_pool::serial_execution_, true))
+        {}
+
+        serial_execution_scope(const serial_execution_scope&)            = delete;
+        serial_execution_scope& operator=(const serial_execution_scope&) = delete;
+
+        ~serial_execution_scope() noexcept { thread_pool::serial_execution_ = prev_; }
+
+    private:
+        bool prev_;
+    };
+
+    /*
+    * The parallel loops started from the current thread are executed on the specified
+    * thread pool during the lifetime of this object, instead of the global thread pool.
+    * The nested parallel loops started from the worker threads of the pool also use it.
+    */
+    class [[nodiscard]] execution_scope
+    {
+    public:
+        explicit execution_scope(thread_pool& pool) noexcept :
+            prev_(std::exchange(thread_pool::scoped_pool_, &pool))
+        {}
+
+        execution_scope(const execution_scope&)            = delete;
+        execution_scope& operator=(const execution_scope&) = delete;
+
+        ~execution_scope() noexcept { thread_pool::scoped_pool_ = prev_; }
+
+    private:
+        thread_pool* prev_;
     };
 
 
@@ -164,14 +623,110 @@ namespace gapp::detail
     requires std::invocable<F, std::iter_reference_t<Iter>>
     void parallel_for(Iter first, Iter last, F&& f)
     {
-        execution_context::global_thread_pool.execute_loop(first, last, 1, std::forward<F>(f));
+        execution_context::current().execute_loop(first, last, 1, std::forward<F>(f));
     }
 
     template<typename F, typename Iter>
     requires std::invocable<F, std::iter_reference_t<Iter>>
     void parallel_for(Iter first, Iter last, size_t block_size, F&& f)
     {
-        execution_context::global_thread_pool.execute_loop(first, last, block_size, std::forward<F>(f));
+        execution_context::current().execute_loop(first, last, block_size, std::forward<F>(f));
+    }
+
+    template<typename F, typename Iter>
+    requires std::invocable<F, std::iter_reference_t<Iter>>
+    void parallel_for(Iter first, Iter last, schedule_type schedule, F&& f)
+    {
+        execution_context::current().execute_loop(first, last, 1, schedule, std::forward<F>(f));
+    }
+
+    template<typename F, typename Iter>
+    requires std::invocable<F, std::iter_reference_t<Iter>>
+    void parallel_for(Iter first, Iter last, size_t block_size, schedule_type schedule, F&& f)
+    {
+        execution_context::current().execute_loop(first, last, block_size, schedule, std::forward<F>(f));
+    }
+
+    /*
+    * Split [first, last) into blocks of block_size elements, and return the results of reduce_block(block_first, block_last)
+    * for each of the blocks, in order. The blocks are processed in parallel. The block boundaries only depend on the block
+    * size, not on the number of threads, so the results of the parallel reductions don't depend on the number of threads.
+    */
+    template<typename T, typename Iter, typename F>
+    requires std::invocable<F&, Iter, Iter>
+    std::vector<T> parallel_reduce_blocks(Iter first, Iter last, size_t block_size, const T& fill, F&& reduce_block)
+    {
+        GAPP_ASSERT(block_size > 0);
+
+        const size_t iterations  = std::distance(first, last);
+        const size_t block_count = iterations / block_size + bool(iterations % block_size);
+
+        small_vector<Iter> block_bounds(block_count + 1, first);
+        for (size_t i = 0; i < block_count; i++)
+        {
+            block_bounds[i + 1] = std::next(block_bounds[i], std::min(block_size, iterations - i * block_size));
+        }
+
+        std::vector<T> block_results(block_count, fill);
+
+        parallel_for(iota_iterator(0_sz), iota_iterator(block_count), [&](size_t block_idx)
+        {
+            block_results[block_idx] = std::invoke(reduce_block, block_bounds[block_idx], block_bounds[block_idx + 1]);
+        });
+
+        return block_results;
+    }
+
+    /*
+    * Reduce the elements of [first, last) in parallel. Each block of block_size elements is reduced from left to right,
+    * starting from a copy of identity and adding the elements to it using accumulate(T, element). The results of the
+    * blocks are then combined from left to right on the calling thread using combine(T, T). The result is deterministic
+    * even if the operations aren't associative (e.g. floating-point addition), and it doesn't depend on the number of threads.
+    * Returns identity if the range is empty.
+    */
+    template<typename T, typename Iter, typename A, typename R>
+    requires std::invocable<A&, T, std::iter_reference_t<Iter>> && std::invocable<R&, T, T>
+    T parallel_reduce(Iter first, Iter last, size_t block_size, const T& identity, A&& accumulate, R&& combine)
+    {
+        auto block_results = parallel_reduce_blocks(first, last, block_size, identity, [&](Iter block_first, Iter block_last)
+        {
+            T result = identity;
+            for (; block_first != block_last; ++block_first) { result = std::invoke(accumulate, std::move(result), *block_first); }
+            return result;
+        });
+
+        if (block_results.empty()) return identity;
+
+        T result = std::move(block_results.front());
+        for (size_t i = 1; i < block_results.size(); i++)
+        {
+            result = std::invoke(combine, std::move(result), std::move(block_results[i]));
+        }
+
+        return result;
+    }
+
+    /*
+    * Apply transform to each element of [first, last), and reduce the results using reduce, starting from init (the same as
+    * std::transform_reduce). The blocks of block_size elements are reduced in parallel from left to right, and then the results
+    * of the blocks are added to init in order on the calling thread. The result is deterministic even if reduce isn't associative,
+    * and it doesn't depend on the number of threads.
+    */
+    template<typename T, typename Iter, typename R, typename F>
+    requires std::invocable<F&, std::iter_reference_t<Iter>> && std::invocable<R&, T, std::invoke_result_t<F&, std::iter_reference_t<Iter>>>
+    T parallel_transform_reduce(Iter first, Iter last, size_t block_size, T init, R&& reduce, F&& transform)
+    {
+        /* The blocks are non-empty, so their reductions can start from the transform of their first elements instead of an identity element. */
+        auto block_results = parallel_reduce_blocks(first, last, block_size, init, [&](Iter block_first, Iter block_last)
+        {
+            T result = std::invoke(transform, *block_first);
+            while (++block_first != block_last) { result = std::invoke(reduce, std::move(result), std::invoke(transform, *block_first)); }
+            return result;
+        });
+
+        for (T& block_result : block_results) { init = std::invoke(reduce, std::move(init), std::move(block_result)); }
+
+        return init;
     }
 
 } // namespace gapp::detail
@@ -200,6 +755,116 @@ namespace gapp
         return detail::execution_context::global_thread_pool.thread_count();
     }
 
+    /**
+    * Set the strategy used by the idle threads of the global thread pool to wait for new work.
+    * This function is thread-safe, the new policy is used by the threads the next time they become idle.
+    *
+    * @param policy The wait policy used by the threads of the global thread pool.
+    */
+    inline void execution_wait_policy(WaitPolicy policy) noexcept
+    {
+        detail::execution_context::global_thread_pool.wait_policy(policy);
+    }
+
+    /** @returns The wait policy used by the threads of the global thread pool. */
+    inline WaitPolicy execution_wait_policy() noexcept
+    {
+        return detail::execution_context::global_thread_pool.wait_policy();
+    }
+
+    /**
+    * Pin the threads of the global thread pool to specific CPUs. The i-th thread of the pool
+    * will only run on the CPU cpus[i % cpus.size()]. The thread calling solve() is not pinned.
+    *
+    * Pinning only restricts the CPUs the threads can run on (e.g. to the CPUs of a single NUMA node,
+    * see numa_nodes()). The candidates are still distributed dynamically between the threads, so
+    * it doesn't control which NUMA node the memory of a candidate is allocated on or accessed from.
+    *
+    * @note This function is not thread-safe and shouldn't be called while a genetic algorithm
+    *   is running. The affinity is ignored on platforms other than Linux and Windows.
+    *
+    * @throws std::invalid_argument If the threads can't be pinned to the specified CPUs.
+    *   The threads are not pinned to any CPU in this case.
+    *
+    * @param cpus The indices of the logical CPUs to run the threads on. An empty list removes the affinity of the threads.
+    */
+    inline void execution_cpu_affinity(std::vector<size_t> cpus)
+    {
+        detail::execution_context::global_thread_pool.cpu_affinity(std::move(cpus));
+    }
+
+    /** @returns The CPUs the threads of the global thread pool are pinned to. Empty if they aren't pinned. */
+    inline const std::vector<size_t>& execution_cpu_affinity() noexcept
+    {
+        return detail::execution_context::global_thread_pool.cpu_affinity();
+    }
+
+    /**
+    * A pool of threads that can be used to run genetic algorithms separately from the global
+    * thread pool of the library. The GAs using a thread pool run every parallel part of the
+    * runs (e.g. the fitness evaluations, the genetic operators, and the parallel parts of the
+    * algorithms) on the threads of the pool, including the thread calling solve().
+    *
+    * Separate thread pools can be used to run multiple GAs concurrently (e.g. from different threads),
+    * each of them with its own thread budget, without the runs interfering with each other.
+    * A thread pool can also be shared by multiple GAs, in which case the work of the concurrent runs
+    * is distributed between the threads of the pool in a round-robin fashion.
+    *
+    * @note The results of the runs are only reproducible if the thread pool isn't shared by
+    *   GAs running concurrently.
+    */
+    class ThreadPool
+    {
+    public:
+        /**
+        * Create a thread pool.
+        *
+        * @param thread_count The number of threads used to run the GAs, including the thread calling solve(). Must be at least 1.
+        */
+        explicit ThreadPool(size_t thread_count) :
+            pool_(std::make_unique<detail::thread_pool>(std::max(thread_count, 1_sz)))
+        {}
+
+        /** @returns The number of threads used to run the GAs, including the thread calling solve(). */
+        [[nodiscard]]
+        size_t thread_count() const noexcept { return pool_->thread_count(); }
+
+        /**
+        * Set the strategy used by the idle threads of the pool to wait for new work. This function is
+        * thread-safe, the new policy is used by the threads the next time they become idle.
+        *
+        * @param policy The wait policy used by the threads of the pool.
+        */
+        void wait_policy(WaitPolicy policy) noexcept { pool_->wait_policy(policy); }
+
+        /** @returns The wait policy used by the threads of the pool. */
+        [[nodiscard]]
+        WaitPolicy wait_policy() const noexcept { return pool_->wait_policy(); }
+
+        /**
+        * Pin the threads of the pool to specific CPUs. The i-th thread of the pool will only run on
+        * the CPU cpus[i % cpus.size()]. The thread calling solve() is not pinned.
+        * See execution_cpu_affinity() for more details.
+        *
+        * @note This function is not thread-safe and shouldn't be called while a GA is using the pool.
+        *
+        * @throws std::invalid_argument If the threads can't be pinned to the specified CPUs.
+        *   The threads are not pinned to any CPU in this case.
+        *
+        * @param cpus The indices of the logical CPUs to run the threads on. An empty list removes the affinity of the threads.
+        */
+        void cpu_affinity(std::vector<size_t> cpus) { pool_->cpu_affinity(std::move(cpus)); }
+
+        /** @returns The CPUs the threads of the pool are pinned to. Empty if they aren't pinned. */
+        [[nodiscard]]
+        const std::vector<size_t>& cpu_affinity() const noexcept { return pool_->cpu_affinity(); }
+
+    private:
+        std::unique_ptr<detail::thread_pool> pool_;
+
+        friend class GaInfo;
+    };
+
 } // namespace gapp
 
 #endif // !GAPP_UTILITY_THREAD_POOL_HPP
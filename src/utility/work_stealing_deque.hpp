@@ -0,0 +1,165 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#ifndef GAPP_UTILITY_WORK_STEALING_DEQUE_HPP
+#define GAPP_UTILITY_WORK_STEALING_DEQUE_HPP
+
+#include "utility.hpp"
+#include <algorithm>
+#include <vector>
+#include <memory>
+#include <optional>
+#include <atomic>
+#include <type_traits>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+
+namespace gapp::detail
+{
+    /*
+    * Lock-free single-producer, multi-consumer deque based on the Chase-Lev algorithm.
+    * Only the owner thread may call push() and pop(), which operate on the bottom of the
+    * deque, while any thread may call steal(), which takes elements from the top.
+    *
+    * The elements of the deque are read speculatively by the stealing threads, so the element
+    * type is restricted to trivially copyable types (e.g. pointers).
+    *
+    * @see
+    *   Lê, Nhat Minh, et al. "Correct and efficient work-stealing for weak memory models."
+    *   ACM SIGPLAN Notices 48, no. 8 (2013): 69-80.
+    */
+    template<typename T>
+    requires std::is_trivially_copyable_v<T>
+    class work_stealing_deque
+    {
+    public:
+        explicit work_stealing_deque(size_t capacity = 64)
+        {
+            auto& buffer = buffers_.emplace_back(std::make_unique<buffer_t>(std::bit_ceil(std::max(capacity, 2_sz))));
+            buffer_.store(buffer.get(), std::memory_order_relaxed);
+        }
+
+        void push(T elem)
+        {
+            const std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+            const std::int64_t top = top_.load(std::memory_order_acquire);
+            buffer_t* buffer = buffer_.load(std::memory_order_relaxed);
+
+            if (bottom - top >= std::int64_t(buffer->capacity()))
+            {
+                buffer = grow(buffer, top, bottom);
+            }
+
+            buffer->store(bottom, elem);
+            bottom_.store(bottom + 1, std::memory_order_release);
+        }
+
+        [[nodiscard]] std::optional<T> pop() noexcept
+        {
+            const std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+            buffer_t* buffer = buffer_.load(std::memory_order_relaxed);
+            bottom_.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t top = top_.load(std::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                bottom_.store(bottom + 1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+
+            std::optional<T> elem = buffer->load(bottom);
+
+            if (top == bottom)
+            {
+                /* Last element, race against the stealing threads for it. */
+                if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    elem = std::nullopt;
+                }
+                bottom_.store(bottom + 1, std::memory_order_relaxed);
+            }
+
+            return elem;
+        }
+
+        [[nodiscard]] std::optional<T> steal() noexcept
+        {
+            std::int64_t top = top_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+
+            if (top >= bottom) return std::nullopt;
+
+            const T elem = buffer_.load(std::memory_order_acquire)->load(top);
+
+            if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return std::nullopt;
+            }
+
+            return elem;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            const std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+            const std::int64_t top = top_.load(std::memory_order_relaxed);
+
+            return size_t(std::max(bottom - top, std::int64_t{ 0 }));
+        }
+
+    private:
+        class buffer_t
+        {
+        public:
+            explicit buffer_t(size_t capacity) :
+                data_(std::make_unique<std::atomic<T>[]>(capacity)), mask_(capacity - 1)
+            {
+                GAPP_ASSERT(std::has_single_bit(capacity));
+            }
+
+            void store(std::int64_t idx, T elem) noexcept
+            {
+                data_[size_t(idx) & mask_].store(elem, std::memory_order_relaxed);
+            }
+
+            T load(std::int64_t idx) const noexcept
+            {
+                return data_[size_t(idx) & mask_].load(std::memory_order_relaxed);
+            }
+
+            size_t capacity() const noexcept { return mask_ + 1; }
+
+        private:
+            std::unique_ptr<std::atomic<T>[]> data_;
+            size_t mask_;
+        };
+
+        buffer_t* grow(buffer_t* old_buffer, std::int64_t top, std::int64_t bottom)
+        {
+            auto& new_buffer = buffers_.emplace_back(std::make_unique<buffer_t>(2 * old_buffer->capacity()));
+            for (std::int64_t i = top; i != bottom; i++)
+            {
+                new_buffer->store(i, old_buffer->load(i));
+            }
+
+            /* The old buffers can't be freed while the deque is alive, since a stealing thread might still be reading from them. */
+            buffer_.store(new_buffer.get(), std::memory_order_release);
+            return new_buffer.get();
+        }
+
+        alignas(128) std::atomic<std::int64_t> top_ = 0;
+        alignas(128) std::atomic<std::int64_t> bottom_ = 0;
+        alignas(128) std::atomic<buffer_t*> buffer_ = nullptr;
+        std::vector<std::unique_ptr<buffer_t>> buffers_;
+    };
+
+} // namespace gapp::detail
+
+#endif // !GAPP_UTILITY_WORK_STEALING_DEQUE_HPP
@@ -0,0 +1,94 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "gapp.hpp"
+#include <atomic>
+#include <new>
+#include <cstdlib>
+#include <cstddef>
+
+using namespace gapp;
+
+static std::atomic<size_t> allocation_count = 0;
+
+void* operator new(size_t size)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+
+constexpr size_t popsize = 1000;
+constexpr size_t generations = 200;
+constexpr size_t warmup_generations = 100;
+
+/* Returns the average number of heap allocations in the generations after the warmup generations. */
+template<typename GA, typename F>
+static double allocationsPerGeneration(GA& ga, const F& fitness_function)
+{
+    size_t first_count = 0;
+    size_t last_count = 0;
+
+    ga.on_generation_end([&](const GaInfo& info)
+    {
+        if (info.generation_cntr() == warmup_generations) first_count = allocation_count.load();
+        last_count = allocation_count.load();
+    });
+
+    if constexpr (is_bounded<typename GA::GeneType>)
+        ga.solve(fitness_function, fitness_function.bounds(), generations);
+    else
+        ga.solve(fitness_function, generations);
+
+    return double(last_count - first_count) / (generations - warmup_generations - 1);
+}
+
+
+TEST_CASE("allocations_per_generation", "[benchmark]")
+{
+    SECTION("RCGA")
+    {
+        RCGA GA{ popsize };
+        WARN("RCGA (Sphere): " << allocationsPerGeneration(GA, problems::Sphere{ 100 }) << " allocations per generation");
+    }
+    SECTION("RCGA NSGA-II")
+    {
+        RCGA GA{ popsize };
+        GA.algorithm(algorithm::NSGA2{});
+        WARN("RCGA NSGA-II (DTLZ2): " << allocationsPerGeneration(GA, problems::DTLZ2{ 3, 12 }) << " allocations per generation");
+    }
+    SECTION("BinaryGA")
+    {
+        BinaryGA GA{ popsize };
+        WARN("BinaryGA (Sphere): " << allocationsPerGeneration(GA, problems::Sphere{ 10 }) << " allocations per generation");
+    }
+    SECTION("PermutationGA")
+    {
+        PermutationGA GA{ popsize };
+        WARN("PermutationGA (TSP52): " << allocationsPerGeneration(GA, problems::TSP52{}) << " allocations per generation");
+    }
+}
+
+TEST_CASE("generation_time", "[benchmark]")
+{
+    const problems::Sphere f{ 100 };
+
+    BENCHMARK("RCGA")
+    {
+        RCGA GA{ popsize };
+        return GA.solve(f, f.bounds(), 10);
+    };
+
+    const problems::TSP52 tsp;
+
+    BENCHMARK("PermutationGA")
+    {
+        PermutationGA GA{ popsize };
+        return GA.solve(tsp, 10);
+    };
+}
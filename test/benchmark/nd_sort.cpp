@@ -27,24 +27,28 @@ static FitnessMatrix randomFitnessMatrix(size_t pop_size, size_t num_obj)
 
 TEST_CASE("nd_sort_popsize", "[benchmark]")
 {
-    constexpr size_t num_obj = 3;
-    const size_t popsize = GENERATE(40, 200, 1500);
+    const size_t num_obj = GENERATE(2, 3);
+    const size_t popsize = GENERATE(40, 200, 1500, 20000);
 
-    WARN("Population size: " << popsize);
+    WARN("Population size: " << popsize << ", number of objectives: " << num_obj);
 
-    BENCHMARK_ADVANCED("FNDS")(Benchmark::Chronometer meter)
+    FitnessMatrix fmat = randomFitnessMatrix(popsize, num_obj);
+
+    if (popsize <= 1500)
     {
-        FitnessMatrix fmat = randomFitnessMatrix(popsize, num_obj);
+        BENCHMARK("FNDS") { return fastNonDominatedSort(fmat.begin(), fmat.end()); };
+        BENCHMARK("DDS") { return dominanceDegreeSort(fmat.begin(), fmat.end()); };
+    }
 
-        meter.measure([&] { return fastNonDominatedSort(fmat.begin(), fmat.end()); });
-    };
+    BENCHMARK("ENS-SS") { return efficientNonDominatedSort(fmat.begin(), fmat.end()); };
+    BENCHMARK("ENS-BS") { return efficientNonDominatedSortBS(fmat.begin(), fmat.end()); };
 
-    BENCHMARK_ADVANCED("DDS")(Benchmark::Chronometer meter)
+    if (num_obj == 2)
     {
-        FitnessMatrix fmat = randomFitnessMatrix(popsize, num_obj);
+        BENCHMARK("2D") { return twoObjectiveNonDominatedSort(fmat.begin(), fmat.end()); };
+    }
 
-        meter.measure([&] { return dominanceDegreeSort(fmat.begin(), fmat.end()); });
-    };
+    BENCHMARK("nonDominatedSort") { return nonDominatedSort(fmat.begin(), fmat.end()); };
 }
 
 
@@ -55,17 +59,32 @@ TEST_CASE("nd_sort_num_objectives", "[benchmark]")
 
     WARN("Number of objectives: " << num_obj);
 
-    BENCHMARK_ADVANCED("FNDS")(Benchmark::Chronometer meter)
-    {
-        FitnessMatrix fmat = randomFitnessMatrix(popsize, num_obj);
+    FitnessMatrix fmat = randomFitnessMatrix(popsize, num_obj);
+
+    BENCHMARK("FNDS") { return fastNonDominatedSort(fmat.begin(), fmat.end()); };
+    BENCHMARK("DDS") { return dominanceDegreeSort(fmat.begin(), fmat.end()); };
+    BENCHMARK("ENS-SS") { return efficientNonDominatedSort(fmat.begin(), fmat.end()); };
+    BENCHMARK("ENS-BS") { return efficientNonDominatedSortBS(fmat.begin(), fmat.end()); };
+    BENCHMARK("nonDominatedSort") { return nonDominatedSort(fmat.begin(), fmat.end()); };
+}
 
-        meter.measure([&] { return fastNonDominatedSort(fmat.begin(), fmat.end()); });
-    };
 
-    BENCHMARK_ADVANCED("DDS")(Benchmark::Chronometer meter)
+TEST_CASE("nd_sort_many_fronts", "[benchmark]")
+{
+    const size_t num_obj = GENERATE(2, 3, 5);
+    constexpr size_t popsize = 5000;
+
+    WARN("Number of objectives: " << num_obj);
+
+    /* Correlated objectives, resulting in many small fronts. */
+    FitnessMatrix fmat(popsize, num_obj);
+    for (const auto& row : fmat)
     {
-        FitnessMatrix fmat = randomFitnessMatrix(popsize, num_obj);
+        const double base = rng::randomReal();
+        for (double& val : row) { val = base + 0.05 * rng::randomReal(); }
+    }
 
-        meter.measure([&] { return dominanceDegreeSort(fmat.begin(), fmat.end()); });
-    };
+    BENCHMARK("ENS-SS") { return efficientNonDominatedSort(fmat.begin(), fmat.end()); };
+    BENCHMARK("ENS-BS") { return efficientNonDominatedSortBS(fmat.begin(), fmat.end()); };
+    BENCHMARK("nonDominatedSort") { return nonDominatedSort(fmat.begin(), fmat.end()); };
 }
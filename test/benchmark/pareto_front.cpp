@@ -28,7 +28,7 @@ static FitnessMatrix randomFitnessMatrix(size_t pop_size, size_t num_obj)
 TEST_CASE("find_pareto_front_size", "[benchmark]")
 {
     constexpr size_t num_obj = 3;
-    const size_t popsize = GENERATE(40, 200, 1500);
+    const size_t popsize = GENERATE(40, 200, 1500, 10000);
 
     WARN("Population size: " << popsize);
 
@@ -52,6 +52,13 @@ TEST_CASE("find_pareto_front_size", "[benchmark]")
 
         meter.measure([&] { return findParetoFrontKung(fmat); });
     };
+
+    BENCHMARK_ADVANCED("kung_parallel")(Benchmark::Chronometer meter)
+    {
+        FitnessMatrix fmat = randomFitnessMatrix(popsize, num_obj);
+
+        meter.measure([&] { return findParetoFrontKungParallel(fmat); });
+    };
 }
 
 
@@ -82,6 +89,13 @@ TEST_CASE("find_pareto_front_nobj", "[benchmark]")
 
         meter.measure([&] { return findParetoFrontKung(fmat); });
     };
+
+    BENCHMARK_ADVANCED("kung_parallel")(Benchmark::Chronometer meter)
+    {
+        FitnessMatrix fmat = randomFitnessMatrix(popsize, num_obj);
+
+        meter.measure([&] { return findParetoFrontKungParallel(fmat); });
+    };
 }
 
 
@@ -0,0 +1,83 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "gapp.hpp"
+#include <chrono>
+#include <utility>
+#include <cmath>
+#include <cstddef>
+
+using namespace gapp;
+
+/* A fitness function with highly varying evaluation times, where the steady-state model should help. */
+template<typename F>
+class VaryingCostFunction final : public FitnessFunctionBase<RealGene>
+{
+public:
+    VaryingCostFunction(F f, std::chrono::microseconds max_cost) :
+        FitnessFunctionBase<RealGene>(f.bounds().size()), f_(std::move(f)), max_cost_(max_cost)
+    {}
+
+    const BoundsVector<RealGene>& bounds() const noexcept { return f_.bounds(); }
+
+private:
+    FitnessVector invoke(const Candidate<RealGene>& sol) const override
+    {
+        const double cost_fraction = std::abs(std::sin(1000.0 * sol.chromosome[0]));
+        const auto cost = std::chrono::duration_cast<std::chrono::nanoseconds>(cost_fraction * max_cost_);
+
+        const auto end = std::chrono::steady_clock::now() + cost;
+        while (std::chrono::steady_clock::now() < end);
+
+        return f_(sol);
+    }
+
+    F f_;
+    std::chrono::microseconds max_cost_;
+};
+
+
+/* The same number of fitness evaluations is done in both modes, so the run times show the differences in throughput. */
+TEST_CASE("steady_state_throughput", "[benchmark]")
+{
+    constexpr size_t popsize = 100;
+    constexpr size_t generations = 20;
+
+    SECTION("single-objective")
+    {
+        const VaryingCostFunction f{ problems::Rastrigin{ 10 }, std::chrono::microseconds{ 200 } };
+
+        BENCHMARK("generational")
+        {
+            RCGA GA{ popsize };
+            return GA.solve(f, f.bounds(), generations);
+        };
+
+        BENCHMARK("steady_state")
+        {
+            RCGA GA{ popsize };
+            GA.steady_state(true);
+            return GA.solve(f, f.bounds(), generations);
+        };
+    }
+
+    SECTION("NSGA-III")
+    {
+        /* The cheap evaluations make the population updates dominate the run times. */
+        const VaryingCostFunction f{ problems::DTLZ2{ 3 }, std::chrono::microseconds{ 10 } };
+
+        BENCHMARK("generational")
+        {
+            RCGA GA{ 10 * popsize, algorithm::NSGA3{} };
+            return GA.solve(f, f.bounds(), generations);
+        };
+
+        BENCHMARK("steady_state")
+        {
+            RCGA GA{ 10 * popsize, algorithm::NSGA3{} };
+            GA.steady_state(true);
+            return GA.solve(f, f.bounds(), generations);
+        };
+    }
+}
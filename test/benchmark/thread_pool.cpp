@@ -4,12 +4,23 @@
 #include <catch2/generators/catch_generators.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
 #include "utility/thread_pool.hpp"
+#include "utility/concurrent_queue.hpp"
+#include "utility/functional.hpp"
+#include "utility/latch.hpp"
 #include "utility/iterators.hpp"
+#include "utility/cpu_topology.hpp"
+#include "encoding/real.hpp"
+#include "problems/single_objective.hpp"
 #include <algorithm>
 #include <numeric>
 #include <execution>
 #include <atomic>
+#include <thread>
+#include <tuple>
+#include <memory>
+#include <vector>
 
+using namespace gapp;
 using namespace gapp::detail;
 
 
@@ -65,3 +76,96 @@ TEST_CASE("parallel_for", "[benchmark]")
         return n.load();
     };
 }
+
+TEST_CASE("parallel_for_imbalanced", "[benchmark]")
+{
+    std::atomic<double> n = 0.0;
+
+    std::vector v(1000, 0.0);
+    std::iota(v.begin(), v.end(), 0.0);
+
+    /* Every 16th iteration is an order of magnitude more expensive than the rest. */
+    auto work = [&](int i)
+    {
+        const int repeats = (i % 16 == 0) ? 10 : 1;
+        for (int r = 0; r < repeats; r++)
+        {
+            n += std::inner_product(v.begin(), v.end(), v.begin(), 0.0) / std::reduce(v.begin(), v.end(), 0.0);
+        }
+    };
+
+    BENCHMARK("static_blocks")
+    {
+        parallel_for(iota_iterator(0), iota_iterator(1000), schedule_type::static_blocks, work);
+        return n.load();
+    };
+
+    BENCHMARK("dynamic")
+    {
+        parallel_for(iota_iterator(0), iota_iterator(1000), schedule_type::dynamic, work);
+        return n.load();
+    };
+
+    BENCHMARK("guided")
+    {
+        parallel_for(iota_iterator(0), iota_iterator(1000), schedule_type::guided, work);
+        return n.load();
+    };
+}
+
+TEST_CASE("task_handoff", "[benchmark]")
+{
+    BENCHMARK("parallel_for_empty")
+    {
+        parallel_for(iota_iterator(0_sz), iota_iterator(execution_threads()), [](size_t) {});
+    };
+
+    /* The handoff of a single task through the mutex and condition variable based queue, which was used by the thread pool before. */
+    concurrent_queue<move_only_function<void()>> queue;
+
+    std::jthread worker{ [&]
+    {
+        for (auto task = queue.take(); task.has_value(); task = queue.take()) { std::invoke(*task); }
+    } };
+
+    BENCHMARK("concurrent_queue_single_task")
+    {
+        latch done(1);
+        std::ignore = queue.emplace([&] { done.count_down(); });
+        done.wait();
+    };
+
+    queue.close();
+}
+
+TEST_CASE("evaluation_throughput", "[benchmark]")
+{
+    /* The fitness function reads the entire chromosome of each candidate, so the evaluation speed depends on the
+     * memory bandwidth. Compares the throughput of threads pinned to the CPUs in NUMA node order with unpinned threads.
+     * Only the threads are pinned, the candidates are not allocated on or assigned to the nodes of the threads. */
+    problems::Sphere f{ 4000 };
+
+    std::vector<size_t> numa_ordered_cpus;
+    for (const NumaNode& node : numa_nodes())
+    {
+        numa_ordered_cpus.insert(numa_ordered_cpus.end(), node.cpus.begin(), node.cpus.end());
+    }
+
+    auto unpinned_pool = std::make_shared<ThreadPool>(execution_threads());
+    auto pinned_pool = std::make_shared<ThreadPool>(execution_threads());
+    pinned_pool->cpu_affinity(numa_ordered_cpus);
+
+    RCGA ga{ 1000 };
+
+    BENCHMARK("unpinned_threads")
+    {
+        ga.thread_pool(unpinned_pool);
+        return ga.solve(f, f.bounds(), 10);
+    };
+
+    BENCHMARK("pinned_threads")
+    {
+        ga.thread_pool(pinned_pool);
+        return ga.solve(f, f.bounds(), 10);
+    };
+}
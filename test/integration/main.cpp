@@ -6,6 +6,7 @@
 #include "integer_soga.hpp"
 #include "nsga2.hpp"
 #include "nsga3.hpp"
+#include "moead.hpp"
 #include "variable_length.hpp"
 
 int main()
@@ -47,6 +48,8 @@ int main()
         benchmark_nsga3_zdt();
         benchmark_nsga3_dtlz();
 
+        benchmark_moead_dtlz();
+
         variable_chrom_length();
     }
 }
\ No newline at end of file
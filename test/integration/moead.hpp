@@ -0,0 +1,41 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#ifndef GA_TEST_BENCHMARK_MOEAD_HPP
+#define GA_TEST_BENCHMARK_MOEAD_HPP
+
+#include "encoding/real.hpp"
+#include "algorithm/algorithm.hpp"
+#include "crossover/real.hpp"
+#include "mutation/real.hpp"
+#include "stop_condition/stop_condition.hpp"
+#include "problems/many_objective.hpp"
+#include "benchmark_utils.hpp"
+
+using namespace gapp;
+using namespace gapp::problems;
+
+template<typename Problem>
+void benchmark_real_moead(Problem problem, size_t generations, size_t population_size = 100)
+{
+    RCGA GA(population_size);
+
+    GA.algorithm(algorithm::MOEAD{});
+    GA.crossover_method(crossover::real::SimulatedBinary{ 0.9 });
+    GA.mutation_method(mutation::real::Uniform{ 1.0 / problem.num_vars() });
+
+    benchmarkMoga(GA, generations, "MOEAD", std::move(problem));
+}
+
+/* Same problems and parameters as benchmark_nsga3_dtlz(), so the results and run times can be compared directly. */
+inline void benchmark_moead_dtlz(size_t generations = 1000, size_t population_size = 100, size_t dim = 3)
+{
+    benchmark_real_moead(DTLZ1{ dim }, generations, population_size);
+    benchmark_real_moead(DTLZ2{ dim }, generations, population_size);
+    benchmark_real_moead(DTLZ3{ dim }, generations, population_size);
+    benchmark_real_moead(DTLZ4{ dim }, generations, population_size);
+    benchmark_real_moead(DTLZ5{ dim }, generations, population_size);
+    benchmark_real_moead(DTLZ6{ dim }, generations, population_size);
+    benchmark_real_moead(DTLZ7{ dim }, generations, population_size);
+}
+
+#endif // !GA_TEST_BENCHMARK_MOEAD_HPP
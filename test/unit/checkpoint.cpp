@@ -0,0 +1,319 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#include <catch2/catch_test_macros.hpp>
+#include "gapp.hpp"
+#include "utility/serialization.hpp"
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#include <span>
+#include <memory>
+#include <stdexcept>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+using namespace gapp;
+
+constexpr static size_t num_gen = 20;
+constexpr static size_t popsize = 20;
+
+
+TEST_CASE("checkpoint_properties", "[checkpoint]")
+{
+    RCGA GA{ popsize };
+
+    REQUIRE(GA.checkpoint_file().empty());
+    REQUIRE(GA.checkpoint_interval() == 0);
+
+    GA.checkpoint("gapp_test.ckpt", 5);
+    REQUIRE(GA.checkpoint_file() == "gapp_test.ckpt");
+    REQUIRE(GA.checkpoint_interval() == 5);
+
+    GA.checkpoint("gapp_test.ckpt", 0);
+    REQUIRE(GA.checkpoint_file().empty());
+    REQUIRE(GA.checkpoint_interval() == 0);
+}
+
+TEST_CASE("checkpoint_resume_soga", "[checkpoint]")
+{
+    const auto path = std::filesystem::temp_directory_path() / "gapp_soga.ckpt";
+    const problems::Rastrigin f{ 5 };
+
+    RCGA GA1{ popsize };
+    GA1.checkpoint(path, num_gen / 2);
+
+    rng::prng.seed(0x9e3779b97f4a7c15);
+    const auto solutions1 = GA1.solve(f, f.bounds(), num_gen);
+
+    REQUIRE(std::filesystem::exists(path));
+
+    RCGA GA2;
+    const auto solutions2 = GA2.solve(f, path);
+
+    REQUIRE(GA2.population_size() == popsize);
+    REQUIRE(GA2.generation_cntr() == GA1.generation_cntr());
+    REQUIRE(GA2.num_fitness_evals() == GA1.num_fitness_evals());
+    REQUIRE(GA2.population() == GA1.population());
+    REQUIRE(solutions2 == solutions1);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("checkpoint_resume_nsga3", "[checkpoint]")
+{
+    const auto path = std::filesystem::temp_directory_path() / "gapp_nsga3.ckpt";
+    const problems::DTLZ2 f{ 3, 12 };
+
+    RCGA GA1{ popsize };
+    GA1.algorithm(algorithm::NSGA3{});
+    GA1.checkpoint(path, num_gen / 2);
+
+    rng::prng.seed(0x9e3779b97f4a7c15);
+    const auto solutions1 = GA1.solve(f, f.bounds(), num_gen);
+
+    RCGA GA2;
+    GA2.algorithm(algorithm::NSGA3{});
+    const auto solutions2 = GA2.solve(f, path);
+
+    REQUIRE(GA2.population() == GA1.population());
+    REQUIRE(solutions2 == solutions1);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("checkpoint_resume_moead", "[checkpoint]")
+{
+    const auto path = std::filesystem::temp_directory_path() / "gapp_moead.ckpt";
+    const problems::DTLZ2 f{ 3, 12 };
+
+    RCGA GA1{ popsize };
+    GA1.algorithm(algorithm::MOEAD{});
+    GA1.checkpoint(path, num_gen / 2);
+
+    rng::prng.seed(0x9e3779b97f4a7c15);
+    const auto solutions1 = GA1.solve(f, f.bounds(), num_gen);
+
+    RCGA GA2;
+    GA2.algorithm(algorithm::MOEAD{});
+    const auto solutions2 = GA2.solve(f, path);
+
+    REQUIRE(GA2.population() == GA1.population());
+    REQUIRE(solutions2 == solutions1);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("checkpoint_invalid", "[checkpoint]")
+{
+    const auto path = std::filesystem::temp_directory_path() / "gapp_invalid.ckpt";
+    const problems::Sphere f{ 5 };
+
+    RCGA GA{ popsize };
+
+    REQUIRE_THROWS_AS(GA.solve(f, std::filesystem::temp_directory_path() / "gapp_missing.ckpt"), std::runtime_error);
+
+    std::ofstream{ path } << "not a checkpoint";
+    REQUIRE_THROWS_AS(GA.solve(f, path), std::runtime_error);
+
+    GA.checkpoint(path, 1);
+    GA.solve(f, f.bounds(), 2);
+
+    REQUIRE_THROWS_AS(GA.solve(problems::Sphere{ 3 }, path), std::runtime_error);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("checkpoint_invalid_popsize", "[checkpoint]")
+{
+    const auto path = std::filesystem::temp_directory_path() / "gapp_invalid_popsize.ckpt";
+    const problems::Sphere f{ 5 };
+
+    RCGA GA{ popsize };
+    GA.checkpoint(path, 1);
+    GA.solve(f, f.bounds(), 2);
+
+    std::vector<char> data(std::filesystem::file_size(path));
+    std::ifstream{ path, std::ios::binary }.read(data.data(), data.size());
+
+    /* The population size is written after the magic, the version, the byte order marker, and the size of the genes. */
+    const std::uint64_t zero = 0;
+    std::memcpy(data.data() + 24, &zero, sizeof(zero));
+    std::ofstream{ path, std::ios::binary | std::ios::trunc }.write(data.data(), data.size());
+
+    REQUIRE_THROWS_AS(GA.solve(f, path), std::runtime_error);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("checkpoint_thread_count", "[checkpoint]")
+{
+    const auto path = std::filesystem::temp_directory_path() / "gapp_thread_count.ckpt";
+    const problems::Rastrigin f{ 5 };
+
+    auto run = [&](size_t thread_count)
+    {
+        RCGA GA{ popsize };
+        GA.thread_pool(std::make_shared<ThreadPool>(thread_count));
+        GA.checkpoint(path, num_gen / 2);
+
+        rng::prng.seed(0x9e3779b97f4a7c15);
+        return GA.solve(f, f.bounds(), num_gen);
+    };
+
+    auto resume = [&](size_t thread_count)
+    {
+        RCGA GA;
+        GA.thread_pool(std::make_shared<ThreadPool>(thread_count));
+        return GA.solve(f, path);
+    };
+
+    SECTION("per-thread mode")
+    {
+        rng::ScopedMode per_thread_mode{ rng::Mode::PerThread };
+
+        run(2);
+        REQUIRE_THROWS_AS(resume(3), std::runtime_error);
+    }
+
+    SECTION("counter-based mode")
+    {
+        rng::ScopedMode counter_based_mode{ rng::Mode::CounterBased };
+
+        const auto solutions = run(2);
+        REQUIRE(resume(3) == solutions);
+    }
+
+    std::filesystem::remove(path);
+}
+
+/* The state written by NSGA3::saveStateImpl. */
+struct NSGA3State
+{
+    struct CandidateTraits
+    {
+        size_t rank;
+        size_t ref_idx;
+        double ref_dist;
+    };
+
+    std::vector<double> ref_lines;
+    std::vector<double> extreme_points;
+    std::uint64_t ref_shape[2];
+    std::uint64_t extreme_shape[2];
+    std::vector<CandidateTraits> sol_info;
+    std::vector<size_t> niche_counts;
+    std::vector<double> ideal_point;
+    std::vector<double> nadir_point;
+
+    explicit NSGA3State(detail::binary_reader& in)
+    {
+        auto read_matrix = [&](std::uint64_t* shape, std::vector<double>& values)
+        {
+            shape[0] = in.read<std::uint64_t>();
+            shape[1] = in.read<std::uint64_t>();
+            values.resize(shape[0] * shape[1]);
+            for (double& value : values) value = in.read<double>();
+        };
+        read_matrix(ref_shape, ref_lines);
+        read_matrix(extreme_shape, extreme_points);
+
+        auto read_vector = [&]<typename T>(std::vector<T>& vec) { const auto values = in.read_array<T>(); vec.assign(values.begin(), values.end()); };
+        read_vector(sol_info);
+        read_vector(niche_counts);
+        read_vector(ideal_point);
+        read_vector(nadir_point);
+    }
+
+    std::vector<std::byte> serialize() const
+    {
+        detail::binary_writer out;
+
+        auto write_matrix = [&](const std::uint64_t* shape, const std::vector<double>& values)
+        {
+            out.write(shape[0]);
+            out.write(shape[1]);
+            for (double value : values) out.write(value);
+        };
+        write_matrix(ref_shape, ref_lines);
+        write_matrix(extreme_shape, extreme_points);
+
+        out.write_array(sol_info);
+        out.write_array(niche_counts);
+        out.write_array(ideal_point);
+        out.write_array(nadir_point);
+
+        return out.release();
+    }
+};
+
+TEST_CASE("checkpoint_invalid_nsga3_state", "[checkpoint]")
+{
+    const problems::DTLZ2 f{ 3, 12 };
+
+    RCGA GA{ popsize };
+    GA.algorithm(algorithm::NSGA3{});
+    GA.solve(f, f.bounds(), 5);
+
+    detail::binary_writer out;
+    GA.algorithm().saveState(out);
+
+    detail::binary_reader in(out.data());
+    const NSGA3State state(in);
+
+    auto load = [&](const NSGA3State& modified_state)
+    {
+        algorithm::NSGA3 algorithm;
+        algorithm.initialize(GA);
+
+        const auto data = modified_state.serialize();
+        detail::binary_reader state_in(data);
+        algorithm.loadState(state_in);
+    };
+
+    REQUIRE_NOTHROW(load(state));
+
+    NSGA3State invalid_ref_idx = state;
+    invalid_ref_idx.sol_info[0].ref_idx = state.ref_shape[0];
+    REQUIRE_THROWS_AS(load(invalid_ref_idx), std::runtime_error);
+
+    NSGA3State invalid_sol_info = state;
+    invalid_sol_info.sol_info.pop_back();
+    REQUIRE_THROWS_AS(load(invalid_sol_info), std::runtime_error);
+
+    NSGA3State invalid_ideal_point = state;
+    invalid_ideal_point.ideal_point.push_back(0.0);
+    REQUIRE_THROWS_AS(load(invalid_ideal_point), std::runtime_error);
+
+    NSGA3State invalid_nadir_point = state;
+    invalid_nadir_point.nadir_point.pop_back();
+    REQUIRE_THROWS_AS(load(invalid_nadir_point), std::runtime_error);
+}
+
+TEST_CASE("checkpoint_invalid_nsga2_state", "[checkpoint]")
+{
+    const problems::DTLZ2 f{ 3, 12 };
+
+    RCGA GA{ popsize };
+    GA.algorithm(algorithm::NSGA2{});
+    GA.solve(f, f.bounds(), 5);
+
+    auto load = [&](std::span<const size_t> ranks, std::span<const double> dists)
+    {
+        detail::binary_writer out;
+        out.write_array(ranks);
+        out.write_array(dists);
+
+        algorithm::NSGA2 algorithm;
+        algorithm.initialize(GA);
+
+        detail::binary_reader in(out.data());
+        algorithm.loadState(in);
+    };
+
+    const std::vector<size_t> ranks(popsize, 0);
+    const std::vector<double> dists(popsize, 1.0);
+
+    REQUIRE_NOTHROW(load(ranks, dists));
+    REQUIRE_THROWS_AS(load(std::span(ranks).first(popsize - 1), std::span(dists).first(popsize - 1)), std::runtime_error);
+}
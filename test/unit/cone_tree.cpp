@@ -1,7 +1,11 @@
 ﻿/* Copyright (c) 2022 Krisztián Rugási. Subject to the MIT License. */
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include "utility/cone_tree.hpp"
+#include "utility/math.hpp"
+#include "utility/rng.hpp"
+#include <numeric>
 #include <type_traits>
 
 using namespace gapp::detail;
@@ -57,6 +61,38 @@ TEST_CASE("cone_tree lookup", "[cone_tree]")
 
     best = tree.findBestMatch(ConeTree::Point{ 0.1, 0.5, 0.8 });
     REQUIRE(*best.elem == ConeTree::Point{ 0.6, 0.8, 0.8 });
+    REQUIRE(points[best.idx] == ConeTree::Point{ 0.6, 0.8, 0.8 });
+}
+
+TEST_CASE("cone_tree_linear_search", "[cone_tree]")
+{
+    const size_t dim = GENERATE(2, 3, 5);
+
+    Matrix<double> points(2000, dim);
+    for (size_t i = 0; i < points.nrows(); i++)
+    {
+        for (double& coord : points[i]) coord = gapp::rng::randomReal();
+        gapp::math::normalizeVector(points[i]);
+    }
+
+    const ConeTree tree(points);
+    REQUIRE(tree.size() == points.nrows());
+
+    for (size_t i = 0; i < 100; i++)
+    {
+        ConeTree::Point query(dim);
+        for (double& coord : query) coord = gapp::rng::randomReal(-0.2, 1.0);
+
+        const auto inner_prod = [&](const auto& point) { return std::inner_product(query.begin(), query.end(), point.begin(), 0.0); };
+
+        double best_prod = -gapp::math::inf<double>;
+        for (const auto& point : points) best_prod = std::max(best_prod, inner_prod(point));
+
+        const auto best = tree.findBestMatch(query);
+
+        REQUIRE(best.prod == best_prod);
+        REQUIRE(inner_prod(points[best.idx]) == best_prod);
+    }
 }
 
 TEST_CASE("empty_cone_tree", "[cone_tree]")
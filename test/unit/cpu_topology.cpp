@@ -0,0 +1,38 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#include <catch2/catch_test_macros.hpp>
+#include "utility/cpu_topology.hpp"
+#include <algorithm>
+#include <vector>
+#include <cstddef>
+
+using namespace gapp;
+using namespace gapp::detail;
+
+TEST_CASE("parse_cpu_list", "[cpu_topology]")
+{
+    REQUIRE(parse_cpu_list("0") == std::vector<size_t>{ 0 });
+    REQUIRE(parse_cpu_list("0-3") == std::vector<size_t>{ 0, 1, 2, 3 });
+    REQUIRE(parse_cpu_list("0-1,4,6-7\n") == std::vector<size_t>{ 0, 1, 4, 6, 7 });
+
+    REQUIRE(parse_cpu_list("").empty());
+    REQUIRE(parse_cpu_list("\n").empty());
+    REQUIRE(parse_cpu_list("3-1").empty());
+    REQUIRE(parse_cpu_list("0,").empty());
+    REQUIRE(parse_cpu_list("a-b").empty());
+}
+
+TEST_CASE("numa_nodes", "[cpu_topology]")
+{
+    const auto nodes = numa_nodes();
+
+    REQUIRE(!nodes.empty());
+
+    for (const NumaNode& node : nodes)
+    {
+        REQUIRE(!node.cpus.empty());
+        REQUIRE(std::is_sorted(node.cpus.begin(), node.cpus.end()));
+    }
+
+    REQUIRE(std::is_sorted(nodes.begin(), nodes.end(), [](const NumaNode& lhs, const NumaNode& rhs) { return lhs.id < rhs.id; }));
+}
@@ -7,6 +7,7 @@
 #include "crossover/crossover.hpp"
 #include "crossover/crossover_impl.hpp"
 #include "test_utils.hpp"
+#include <type_traits>
 
 using namespace gapp;
 using namespace gapp::crossover;
@@ -18,7 +19,9 @@ TEST_CASE("single_point_crossover", "[crossover]")
     Candidate<int> parent2{ { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 } };
                                             //
 
-    auto [child1, child2] = singlePointCrossoverImpl(parent1, parent2, 5);
+    CandidatePair<int> children;
+    singlePointCrossoverImpl(parent1, parent2, 5, children);
+    const auto& [child1, child2] = children;
 
     REQUIRE(child1.chromosome == Chromosome<int>{ { 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 } });
     REQUIRE(child2.chromosome == Chromosome<int>{ { 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1 } });
@@ -30,7 +33,9 @@ TEST_CASE("two_point_crossover", "[crossover]")
     Candidate<int> parent2{ { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 } };
                                        //                //
 
-    auto [child1, child2] = twoPointCrossoverImpl(parent1, parent2, { 9, 3 });
+    CandidatePair<int> children;
+    twoPointCrossoverImpl(parent1, parent2, { 9, 3 }, children);
+    const auto& [child1, child2] = children;
 
     REQUIRE(child1.chromosome == Chromosome<int>{ { 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0 } });
     REQUIRE(child2.chromosome == Chromosome<int>{ { 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1 } });
@@ -42,7 +47,9 @@ TEST_CASE("npoint_crossover", "[crossover]")
     Candidate<char> parent2{ { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 } };
                                  //    //          //          //
 
-    auto [child1, child2] = nPointCrossoverImpl(parent1, parent2, { 1, 3, 7, 11 });
+    CandidatePair<char> children;
+    nPointCrossoverImpl(parent1, parent2, { 1, 3, 7, 11 }, children);
+    const auto& [child1, child2] = children;
 
     REQUIRE(child1.chromosome == Chromosome<char>{ { 1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1 } });
     REQUIRE(child2.chromosome == Chromosome<char>{ { 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0 } });
@@ -54,8 +61,9 @@ TEMPLATE_TEST_CASE("order1_crossover", "[crossover]", int, unsigned)
     Candidate<TestType> parent1{ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 } };
     Candidate<TestType> parent2{ { 4, 5, 0, 6, 1, 2, 8, 3, 9, 7 } };
 
-    auto child1 = order1CrossoverImpl(parent1, parent2, 4, 8);
-    auto child2 = order1CrossoverImpl(parent2, parent1, 4, 8);
+    Candidate<TestType> child1, child2;
+    order1CrossoverImpl(parent1, parent2, 4, 8, child1);
+    order1CrossoverImpl(parent2, parent1, 4, 8, child2);
 
     REQUIRE(child1.chromosome == Chromosome<TestType>{ { 1, 2, 8, 3, 4, 5, 6, 7, 9, 0 } });
     REQUIRE(child2.chromosome == Chromosome<TestType>{ { 4, 5, 6, 7, 1, 2, 8, 3, 9, 0 } });
@@ -66,8 +74,9 @@ TEMPLATE_TEST_CASE("order2_crossover", "[crossover]", int, unsigned)
     Candidate<TestType> parent1{ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 } };
     Candidate<TestType> parent2{ { 4, 5, 0, 6, 1, 2, 8, 3, 9, 7 } };
 
-    auto child1 = order2CrossoverImpl(parent1, parent2, 4, 8);
-    auto child2 = order2CrossoverImpl(parent2, parent1, 4, 8);
+    Candidate<TestType> child1, child2;
+    order2CrossoverImpl(parent1, parent2, 4, 8, child1);
+    order2CrossoverImpl(parent2, parent1, 4, 8, child2);
 
     REQUIRE(child1.chromosome == Chromosome<TestType>{ { 0, 1, 2, 8, 4, 5, 6, 7, 3, 9 } });
     REQUIRE(child2.chromosome == Chromosome<TestType>{ { 0, 4, 5, 6, 1, 2, 8, 3, 7, 9 } });
@@ -78,8 +87,9 @@ TEMPLATE_TEST_CASE("position_crossover", "[crossover]", int, unsigned)
     Candidate<TestType> parent1{ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 } };
     Candidate<TestType> parent2{ { 4, 5, 0, 6, 1, 2, 8, 3, 9, 7 } };
 
-    auto child1 = positionCrossoverImpl(parent1, parent2, { { 0, 3, 4, 7 } });
-    auto child2 = positionCrossoverImpl(parent2, parent1, { { 0, 3, 4, 7 } });
+    Candidate<TestType> child1, child2;
+    positionCrossoverImpl(parent1, parent2, { { 0, 3, 4, 7 } }, child1);
+    positionCrossoverImpl(parent2, parent1, { { 0, 3, 4, 7 } }, child2);
 
     REQUIRE(child1.chromosome == Chromosome<TestType>{ { 0, 5, 6, 3, 4, 1, 2, 7, 8, 9 } });
     REQUIRE(child2.chromosome == Chromosome<TestType>{ { 4, 0, 2, 6, 1, 5, 7, 3, 8, 9 } });
@@ -92,7 +102,9 @@ TEST_CASE("cycle_crossover", "[crossover]")
 
     // cycle0 : 0 - 4 - 1 - 5 - 2 , cycle1 : 3 - 6 - 8 - 9 - 7
 
-    auto [child1, child2] = cycleCrossoverImpl(parent1, parent2);
+    CandidatePair<int> children;
+    cycleCrossoverImpl(parent1, parent2, children);
+    const auto& [child1, child2] = children;
 
     REQUIRE(child1.chromosome == Chromosome<int>{ { 0, 1, 2, 6, 4, 5, 8, 3, 9, 7 } });
     REQUIRE(child2.chromosome == Chromosome<int>{ { 4, 5, 0, 3, 1, 2, 6, 7, 8, 9 } });
@@ -103,8 +115,9 @@ TEMPLATE_TEST_CASE("edge_crossover", "[crossover]", int, unsigned)
     Candidate<TestType> parent1{ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 } };
     Candidate<TestType> parent2{ { 4, 5, 0, 6, 1, 2, 8, 3, 9, 7 } };
 
-    auto child1 = edgeCrossoverImpl(parent1, parent2);
-    auto child2 = edgeCrossoverImpl(parent2, parent1);
+    Candidate<TestType> child1, child2;
+    edgeCrossoverImpl(parent1, parent2, child1);
+    edgeCrossoverImpl(parent2, parent1, child2);
 
     REQUIRE(child1.chromosome == Chromosome<TestType>{ { 0, 5, 4, 1, 6, 7, 9, 8, 3, 2 } });
     REQUIRE(child2.chromosome == Chromosome<TestType>{ { 4, 5, 0, 6, 1, 2, 3, 9, 8, 7 } });
@@ -115,8 +128,9 @@ TEMPLATE_TEST_CASE("pmx_crossover", "[crossover]", int, unsigned)
     Candidate<TestType> parent1{ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 } };
     Candidate<TestType> parent2{ { 4, 5, 0, 6, 1, 2, 8, 3, 9, 7 } };
 
-    auto child1 = pmxCrossoverImpl(parent1, parent2, 4, 8);
-    auto child2 = pmxCrossoverImpl(parent2, parent1, 4, 8);
+    Candidate<TestType> child1, child2;
+    pmxCrossoverImpl(parent1, parent2, 4, 8, child1);
+    pmxCrossoverImpl(parent2, parent1, 4, 8, child2);
 
     REQUIRE(child1.chromosome == Chromosome<TestType>{ { 1, 2, 0, 8, 4, 5, 6, 7, 9, 3 } });
     REQUIRE(child2.chromosome == Chromosome<TestType>{ { 0, 4, 5, 7, 1, 2, 8, 3, 6, 9 } });
@@ -183,3 +197,66 @@ TEST_CASE("crossover_fitness_eval", "[crossover]")
         REQUIRE((!child1.is_evaluated() || child2.fitness == parent1.fitness));
     }
 }
+
+TEST_CASE("crossover_recycled_children", "[crossover]")
+{
+    BinaryGA context;
+    context.solve(DummyFitnessFunction<BinaryGene>(10), 1);
+
+    Candidate<BinaryGene> parent1{ { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } };
+    Candidate<BinaryGene> parent2{ { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 } };
+    parent1.fitness = { 0.0 };
+    parent2.fitness = { 1.0 };
+
+    CandidatePair<BinaryGene> children{ Candidate<BinaryGene>(10), Candidate<BinaryGene>(10) };
+
+    const auto* storage1 = children.first.chromosome.data();
+    const auto* storage2 = children.second.chromosome.data();
+
+    SECTION("unchanged chromosomes")
+    {
+        binary::TwoPoint crossover{ 0.0 };
+        crossover(context, parent1, parent2, children);
+
+        REQUIRE(children.first == parent1);
+        REQUIRE(children.second == parent2);
+        REQUIRE(children.first.fitness == parent1.fitness);
+        REQUIRE(children.second.fitness == parent2.fitness);
+    }
+
+    SECTION("changed chromosomes")
+    {
+        binary::TwoPoint crossover{ 1.0 };
+        crossover(context, parent1, parent2, children);
+
+        REQUIRE(children.first.chromosome.size() == 10);
+        REQUIRE(children.second.chromosome.size() == 10);
+    }
+
+    REQUIRE(children.first.chromosome.data() == storage1);
+    REQUIRE(children.second.chromosome.data() == storage2);
+}
+
+TEST_CASE("crossover_overrides", "[crossover]")
+{
+    /* The derived classes must implement the crossover, which is checked at compile time. */
+    STATIC_REQUIRE(std::is_abstract_v<Crossover<RealGene>>);
+    STATIC_REQUIRE(std::is_abstract_v<InPlaceCrossover<RealGene>>);
+
+    STATIC_REQUIRE(!std::is_abstract_v<real::Wright>);
+    STATIC_REQUIRE(!std::is_abstract_v<Lambda<RealGene>>);
+
+    BinaryGA context;
+    context.solve(DummyFitnessFunction<BinaryGene>(10), 1);
+
+    Candidate<BinaryGene> parent1{ { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } };
+    Candidate<BinaryGene> parent2{ { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 } };
+    parent1.fitness = { 0.0 };
+    parent2.fitness = { 1.0 };
+
+    /* The crossovers returning a new pair of children are implemented using crossover_into(). */
+    const auto [child1, child2] = binary::Uniform{ 1.0 }(context, parent1, parent2);
+
+    REQUIRE(child1.chromosome.size() == 10);
+    REQUIRE(child2.chromosome.size() == 10);
+}
@@ -0,0 +1,196 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#include <catch2/catch_test_macros.hpp>
+#include "gapp.hpp"
+#include <atomic>
+#include <numeric>
+#include <memory>
+#include <span>
+#include <cmath>
+#include <cstddef>
+
+using namespace gapp;
+
+class BatchFitnessFunction final : public FitnessFunctionBase<RealGene>
+{
+public:
+    explicit BatchFitnessFunction(size_t chrom_len) :
+        FitnessFunctionBase<RealGene>(chrom_len)
+    {}
+
+    mutable std::atomic<size_t> single_evals = 0;
+    mutable std::atomic<size_t> batch_evals = 0;
+    mutable std::atomic<size_t> batch_calls = 0;
+
+private:
+    FitnessVector invoke(const Candidate<RealGene>& sol) const override
+    {
+        single_evals++;
+        return { sol[0] };
+    }
+
+    bool invoke_batch(std::span<const Candidate<RealGene>*> sols, FitnessMatrix& fitness_matrix) const override
+    {
+        REQUIRE(fitness_matrix.nrows() == sols.size());
+        REQUIRE(fitness_matrix.ncols() == 1);
+
+        for (size_t i = 0; i < sols.size(); i++)
+        {
+            REQUIRE(!sols[i]->is_evaluated());
+            fitness_matrix[i][0] = (*sols[i])[0];
+        }
+
+        batch_calls++;
+        batch_evals += sols.size();
+
+        return true;
+    }
+};
+
+class ContiguousFitnessFunction final : public FitnessFunctionBase<RealGene>
+{
+public:
+    explicit ContiguousFitnessFunction(size_t chrom_len) :
+        FitnessFunctionBase<RealGene>(chrom_len)
+    {}
+
+    mutable std::atomic<size_t> batch_evals = 0;
+    mutable std::atomic<size_t> contiguous_evals = 0;
+
+private:
+    FitnessVector invoke(const Candidate<RealGene>& sol) const override
+    {
+        return { std::accumulate(sol.begin(), sol.end(), 0.0) };
+    }
+
+    bool invoke_batch(std::span<const Candidate<RealGene>*> sols, FitnessMatrix&) const override
+    {
+        batch_evals += sols.size();
+        return false;
+    }
+
+    bool invoke_batch_contiguous(const PopulationMatrix<RealGene>& sols, FitnessMatrix& fitness_matrix) const override
+    {
+        REQUIRE(fitness_matrix.nrows() == sols.size());
+        if (sols.empty()) return true;
+
+        REQUIRE(sols.chromosomes().ncols() == chrom_len());
+
+        for (size_t i = 0; i < sols.size(); i++)
+        {
+            fitness_matrix[i][0] = std::accumulate(sols[i].begin(), sols[i].end(), 0.0);
+        }
+
+        contiguous_evals += sols.size();
+
+        return true;
+    }
+};
+
+TEST_CASE("batch_evaluation", "[fitness_function]")
+{
+    constexpr size_t population_size = 10;
+    constexpr size_t generation_count = 5;
+
+    RCGA ga{ population_size };
+
+    auto fitness_function = std::make_unique<BatchFitnessFunction>(3);
+    const BatchFitnessFunction& fitness_function_ref = *fitness_function;
+
+    const auto solutions = ga.solve(std::move(fitness_function), Bounds{ -1.0, 1.0 }, generation_count);
+
+    REQUIRE(!solutions.empty());
+    REQUIRE(solutions[0].fitness[0] == solutions[0][0]);
+
+    REQUIRE(fitness_function_ref.batch_calls <= generation_count);
+    REQUIRE(fitness_function_ref.batch_evals == ga.num_fitness_evals());
+    REQUIRE(fitness_function_ref.single_evals == 1); // only used for finding the number of objectives
+}
+
+TEST_CASE("batch_evaluation_fallback", "[fitness_function]")
+{
+    constexpr size_t population_size = 10;
+    constexpr size_t generation_count = 5;
+
+    RCGA ga{ population_size };
+
+    problems::Sphere fitness_function{ 3 };
+
+    const auto solutions = ga.solve(fitness_function, fitness_function.bounds(), generation_count);
+
+    REQUIRE(!solutions.empty());
+    REQUIRE(ga.num_fitness_evals() <= population_size * generation_count);
+}
+
+class DeltaFitnessFunction final : public FitnessFunctionBase<RealGene>
+{
+public:
+    explicit DeltaFitnessFunction(size_t chrom_len) :
+        FitnessFunctionBase<RealGene>(chrom_len)
+    {}
+
+    mutable std::atomic<size_t> full_evals = 0;
+    mutable std::atomic<size_t> delta_evals = 0;
+
+private:
+    FitnessVector invoke(const Candidate<RealGene>& sol) const override
+    {
+        full_evals++;
+        return { std::accumulate(sol.begin(), sol.end(), 0.0) };
+    }
+
+    FitnessVector invoke_delta(const FitnessVector& parent_fitness, const Candidate<RealGene>& sol, std::span<const GeneChange<RealGene>> changes) const override
+    {
+        REQUIRE(!changes.empty());
+        REQUIRE(!sol.is_evaluated());
+
+        double fx = parent_fitness[0];
+        for (const auto& [idx, old_value] : changes) { fx += sol[idx] - old_value; }
+
+        delta_evals++;
+        return { fx };
+    }
+};
+
+TEST_CASE("delta_evaluation", "[fitness_function]")
+{
+    constexpr size_t population_size = 10;
+    constexpr size_t generation_count = 5;
+
+    RCGA ga{ population_size };
+    ga.crossover_rate(0.0);
+    ga.mutation_rate(0.1);
+
+    auto fitness_function = std::make_unique<DeltaFitnessFunction>(20);
+    const DeltaFitnessFunction& fitness_function_ref = *fitness_function;
+
+    ga.solve(std::move(fitness_function), Bounds{ -1.0, 1.0 }, generation_count);
+
+    REQUIRE(fitness_function_ref.delta_evals > 0);
+    REQUIRE(fitness_function_ref.delta_evals + fitness_function_ref.full_evals == ga.num_fitness_evals() + 1);
+
+    for (const auto& sol : ga.population())
+    {
+        REQUIRE(sol.changes.empty());
+        REQUIRE(std::abs(sol.fitness[0] - std::accumulate(sol.begin(), sol.end(), 0.0)) < 1E-10);
+    }
+}
+
+TEST_CASE("batch_evaluation_contiguous", "[fitness_function]")
+{
+    constexpr size_t population_size = 10;
+    constexpr size_t generation_count = 5;
+
+    RCGA ga{ population_size };
+
+    auto fitness_function = std::make_unique<ContiguousFitnessFunction>(3);
+    const ContiguousFitnessFunction& fitness_function_ref = *fitness_function;
+
+    const auto solutions = ga.solve(std::move(fitness_function), Bounds{ -1.0, 1.0 }, generation_count);
+
+    REQUIRE(!solutions.empty());
+    REQUIRE(std::abs(solutions[0].fitness[0] - (solutions[0][0] + solutions[0][1] + solutions[0][2])) < 1E-12);
+
+    REQUIRE(fitness_function_ref.contiguous_evals == ga.num_fitness_evals());
+    REQUIRE(fitness_function_ref.batch_evals == 0);
+}
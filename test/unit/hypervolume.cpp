@@ -2,8 +2,12 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include "metrics/pop_stats.hpp"
 #include "core/candidate.hpp"
+#include "utility/math.hpp"
+#include <random>
+#include <cmath>
 
 using namespace gapp;
 using namespace gapp::detail;
@@ -98,3 +102,95 @@ TEST_CASE("hypervolume", "[metrics]")
         REQUIRE(hypervolume(fmat, ref_point) == 0.0);
     }
 }
+
+static FitnessMatrix randomFront(size_t npoints, size_t nobj, std::mt19937& engine)
+{
+    std::normal_distribution<double> dist(0.0, 1.0);
+
+    /* Points on the positive part of the unit sphere. */
+    FitnessMatrix fmat(npoints, nobj);
+    for (auto row : fmat)
+    {
+        double norm = 0.0;
+        for (double& f : row) { f = std::abs(dist(engine)); norm += f * f; }
+        for (double& f : row) f /= std::sqrt(norm);
+    }
+    return fmat;
+}
+
+TEST_CASE("hypervolume_approx", "[metrics]")
+{
+    const size_t nobj = GENERATE(2, 3, 5);
+
+    std::mt19937 engine(nobj);
+    const FitnessMatrix fmat = randomFront(50, nobj, engine);
+    const FitnessVector ref_point(nobj, -0.5);
+
+    const double exact = hypervolume(fmat, ref_point);
+
+    REQUIRE(hypervolumeApprox(fmat, ref_point, 0.001) == Approx(exact).epsilon(0.005));
+    REQUIRE(hypervolumeApprox(fmat, ref_point, 0.01) == Approx(exact).epsilon(0.05));
+
+    SECTION("single point")
+    {
+        const FitnessMatrix point(1, nobj, 1.0);
+        REQUIRE(hypervolumeApprox(point, ref_point, 0.01) == Approx(std::pow(1.5, nobj)));
+    }
+
+    SECTION("empty")
+    {
+        REQUIRE(hypervolumeApprox(FitnessMatrix{}, ref_point, 0.01) == 0.0);
+    }
+}
+
+TEST_CASE("hypervolume_incremental", "[metrics]")
+{
+    const size_t nobj = GENERATE(2, 3, 4);
+
+    std::mt19937 engine(nobj);
+    const FitnessVector ref_point(nobj, -0.5);
+
+    IncrementalHypervolume incremental;
+    FitnessMatrix fmat = randomFront(40, nobj, engine);
+
+    for (size_t generation = 0; generation < 20; generation++)
+    {
+        REQUIRE(incremental.update(fmat, ref_point) == Approx(hypervolume(fmat, ref_point)).epsilon(1E-10));
+
+        /* Replace a few of the points, some of the new points will be dominated. */
+        const FitnessMatrix new_points = randomFront(3, nobj, engine);
+        for (size_t i = 0; i < new_points.size(); i++)
+        {
+            const size_t idx = std::uniform_int_distribution<size_t>(0, fmat.size() - 1)(engine);
+            const double scale = (i == 0) ? 0.9 : 1.0;
+            for (size_t j = 0; j < nobj; j++) fmat[idx][j] = scale * new_points[i][j];
+        }
+    }
+
+    SECTION("different reference point")
+    {
+        const FitnessVector new_ref_point(nobj, -1.0);
+        REQUIRE(incremental.update(fmat, new_ref_point) == Approx(hypervolume(fmat, new_ref_point)).epsilon(1E-10));
+    }
+}
+
+TEST_CASE("hypervolume_incremental_long_run", "[metrics]")
+{
+    const size_t nobj = GENERATE(2, 3);
+
+    std::mt19937 engine(nobj + 10);
+    const FitnessVector ref_point(nobj, -0.5);
+
+    IncrementalHypervolume incremental;
+    FitnessMatrix fmat = randomFront(40, nobj, engine);
+
+    /* The rounding errors of the incremental updates must not accumulate over many generations. */
+    for (size_t generation = 0; generation < 500; generation++)
+    {
+        REQUIRE(incremental.update(fmat, ref_point) == Approx(hypervolume(fmat, ref_point)).epsilon(1E-12));
+
+        const FitnessMatrix new_point = randomFront(1, nobj, engine);
+        const size_t idx = std::uniform_int_distribution<size_t>(0, fmat.size() - 1)(engine);
+        for (size_t j = 0; j < nobj; j++) fmat[idx][j] = new_point[0][j];
+    }
+}
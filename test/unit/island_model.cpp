@@ -0,0 +1,196 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include "gapp.hpp"
+#include "test_utils.hpp"
+#include <algorithm>
+#include <vector>
+#include <memory>
+#include <cstddef>
+
+using namespace gapp;
+
+constexpr static size_t num_gen = 20;
+constexpr static size_t num_islands = 4;
+constexpr static size_t island_popsize = 10;
+
+
+TEST_CASE("island_model_properties", "[island_model]")
+{
+    IslandModel<RCGA> GA{ num_islands, island_popsize };
+
+    REQUIRE(GA.island_count() == num_islands);
+    REQUIRE(GA.island(0).population_size() == island_popsize);
+
+    GA.topology(MigrationTopology::Random);
+    REQUIRE(GA.topology() == MigrationTopology::Random);
+
+    GA.migration_interval(5);
+    REQUIRE(GA.migration_interval() == 5);
+
+    GA.migration_size(3);
+    REQUIRE(GA.migration_size() == 3);
+
+    GA.max_gen(12);
+    REQUIRE(GA.max_gen() == 12);
+}
+
+TEST_CASE("island_model_solve", "[island_model]")
+{
+    const auto topology = GENERATE(MigrationTopology::Ring, MigrationTopology::FullyConnected, MigrationTopology::Random);
+
+    IslandModel<RCGA> GA{ num_islands, island_popsize };
+    GA.topology(topology);
+    GA.migration_interval(3);
+
+    const problems::Sphere f{ 5 };
+    const auto solutions = GA.solve(f, f.bounds(), num_gen);
+
+    REQUIRE(!solutions.empty());
+    REQUIRE(GA.generation_cntr() == num_gen - 1);
+    REQUIRE(GA.num_fitness_evals() > num_islands * island_popsize);
+
+    for (size_t i = 0; i < GA.island_count(); i++)
+    {
+        REQUIRE(GA.island(i).population().size() == island_popsize);
+        REQUIRE(GA.island(i).generation_cntr() == num_gen - 1);
+    }
+}
+
+TEST_CASE("island_model_multi_objective", "[island_model]")
+{
+    IslandModel<RCGA> GA{ num_islands, island_popsize };
+    for (size_t i = 0; i < GA.island_count(); i++)
+    {
+        GA.island(i).algorithm(algorithm::NSGA3{});
+    }
+
+    const problems::DTLZ2 f{ 3, 12 };
+    const auto solutions = GA.solve(f, f.bounds(), num_gen);
+
+    REQUIRE(!solutions.empty());
+}
+
+TEST_CASE("island_model_migration_algorithm_state", "[island_model]")
+{
+    IslandModel<RCGA> GA{ num_islands, island_popsize };
+    GA.migration_interval(1);
+    GA.migration_size(3);
+
+    for (size_t i = 0; i < GA.island_count(); i++)
+    {
+        GA.island(i).algorithm(algorithm::NSGA3{});
+    }
+
+    const problems::DTLZ2 f{ 3, 12 };
+    GA.solve(f, f.bounds(), num_gen);
+
+    /* The migration in the last generation must be reflected in the state of the algorithms. */
+    for (size_t i = 0; i < GA.island_count(); i++)
+    {
+        const RCGA& island = GA.island(i);
+
+        auto optimal_sols = island.algorithm().optimalSolutions(island, island.population());
+        /* The first front is found using the same non-dominated sorting as the algorithm, since findParetoFront() can treat nearly equal points differently. */
+        Candidates<RealGene> pareto_front;
+        for (const auto& sol : algorithm::dtl::nonDominatedSort(island.fitness_matrix()))
+        {
+            if (sol.rank == 0) pareto_front.push_back(island.population()[sol.idx]);
+        }
+
+        std::sort(optimal_sols.begin(), optimal_sols.end(), [](const auto& lhs, const auto& rhs) { return lhs.chromosome < rhs.chromosome; });
+        std::sort(pareto_front.begin(), pareto_front.end(), [](const auto& lhs, const auto& rhs) { return lhs.chromosome < rhs.chromosome; });
+
+        REQUIRE(optimal_sols == pareto_front);
+    }
+}
+
+TEST_CASE("island_model_stop_condition", "[island_model]")
+{
+    IslandModel<RCGA> GA{ num_islands, island_popsize };
+    GA.island(0).stop_condition(stopping::FitnessEvals(5 * island_popsize));
+
+    const problems::Sphere f{ 5 };
+    GA.solve(f, f.bounds(), num_gen);
+
+    REQUIRE(GA.island(0).generation_cntr() < num_gen - 1);
+    REQUIRE(GA.island(1).generation_cntr() == num_gen - 1);
+}
+
+TEST_CASE("island_model_migration_sources", "[island_model]")
+{
+    constexpr size_t popsize = 8;
+
+    IslandModel<RCGA> islands{ num_islands, popsize };
+    islands.topology(MigrationTopology::FullyConnected);
+    islands.migration_size(2);
+
+    /* The only migration happens after the last generation. */
+    islands.migration_interval(num_gen - 1);
+
+    /* The first gene of every candidate created on an island identifies the island. */
+    auto island_marker = [](size_t idx) { return 0.25 * double(idx); };
+
+    for (size_t i = 0; i < islands.island_count(); i++)
+    {
+        islands.island(i).repair_function([=](const gapp::GA<RealGene>&, const Candidate<RealGene>&, Chromosome<RealGene>& chrom)
+        {
+            chrom[0] = island_marker(i);
+            return true;
+        });
+    }
+
+    islands.solve(DummyFitnessFunction<RealGene>{ 5 }, Bounds{ -1.0, 1.0 }, num_gen);
+
+    /* Each island receives 6 immigrants but only accepts 4 of them, which must come from every source island. */
+    for (size_t destination = 0; destination < islands.island_count(); destination++)
+    {
+        const auto& population = islands.island(destination).population();
+
+        for (size_t source = 0; source < islands.island_count(); source++)
+        {
+            if (source == destination) continue;
+
+            const auto immigrants = std::count_if(population.begin(), population.end(), [&](const auto& sol) { return sol.chromosome[0] == island_marker(source); });
+            REQUIRE(immigrants >= 1);
+        }
+    }
+}
+
+TEST_CASE("island_model_thread_pools", "[island_model]")
+{
+    IslandModel<RCGA> islands{ num_islands, island_popsize };
+
+    auto thread_pool = std::make_shared<ThreadPool>(2);
+    islands.island(1).thread_pool(thread_pool);
+
+    const problems::Sphere f{ 5 };
+    islands.solve(f, f.bounds(), num_gen);
+
+    /* The pools assigned to the islands by the model are only used during the run. */
+    REQUIRE(islands.island(0).thread_pool() == nullptr);
+    REQUIRE(islands.island(1).thread_pool() == thread_pool);
+
+    for (size_t idx = 0; idx < num_islands; idx++)
+    {
+        REQUIRE(islands.island(idx).generation_cntr() == num_gen - 1);
+    }
+}
+
+TEST_CASE("island_model_invalid_island_settings", "[island_model]")
+{
+    IslandModel<RCGA> islands{ num_islands, island_popsize };
+    const problems::Sphere f{ 5 };
+
+    SECTION("steady-state")
+    {
+        islands.island(2).steady_state(true);
+        REQUIRE_THROWS(islands.solve(f, f.bounds(), num_gen));
+    }
+    SECTION("checkpoints")
+    {
+        islands.island(2).checkpoint("island_model_checkpoint.bin", 5);
+        REQUIRE_THROWS(islands.solve(f, f.bounds(), num_gen));
+    }
+}
@@ -6,6 +6,8 @@
 #include <catch2/generators/catch_generators.hpp>
 #include "utility/math.hpp"
 #include <vector>
+#include <span>
+#include <random>
 #include <limits>
 #include <numbers>
 #include <utility>
@@ -316,6 +318,69 @@ TEST_CASE("pareto_compare_three_way", "[math]")
     }
 }
 
+TEST_CASE("pareto_compare_kernels", "[math]")
+{
+    auto [abs, rel] = GENERATE(std::pair{ 0.0, 0.0 }, std::pair{ 1E-12, 10 * eps<double> }, std::pair{ 0.1, 0.0 });
+    const size_t dim = GENERATE(2, 3, 4, 5, 8);
+
+    ScopedTolerances _(abs, rel);
+    INFO("Relative tolerance eps: " << rel << ", absolute tolerance: " << abs << ", dimensions: " << dim);
+
+    const std::vector values = { -inf<double>, -2.0, -1.0, -1.0 + 1E-14, 0.0, 0.05, 1.0, 1.0 + 1E-14, 3.0, inf<double> };
+
+    /* The pareto comparisons implemented using the scalar fp comparisons. */
+    auto reference_less = [](std::span<const double> lhs, std::span<const double> rhs)
+    {
+        bool lhs_has_lower = false;
+        for (size_t i = 0; i < lhs.size(); i++)
+        {
+            if (floatIsLess(rhs[i], lhs[i])) return false;
+            lhs_has_lower |= floatIsLessAssumeNotGreater(lhs[i], rhs[i]);
+        }
+        return lhs_has_lower;
+    };
+
+    auto reference_three_way = [](std::span<const double> lhs, std::span<const double> rhs)
+    {
+        bool lhs_has_lower = false;
+        bool rhs_has_lower = false;
+        for (size_t i = 0; i < lhs.size(); i++)
+        {
+            lhs_has_lower |= (floatCompare(lhs[i], rhs[i]) < 0);
+            rhs_has_lower |= (floatCompare(lhs[i], rhs[i]) > 0);
+        }
+        return (lhs_has_lower && rhs_has_lower) ? 0 : int(rhs_has_lower) - int(lhs_has_lower);
+    };
+
+    std::minstd_rand engine{ 0x12345 };
+    std::uniform_int_distribution<size_t> value_idx{ 0, values.size() - 1 };
+
+    std::vector<double> block;
+
+    for (size_t n = 0; n < 500; n++)
+    {
+        std::vector<double> lhs(dim), rhs(dim);
+        for (double& val : lhs) val = values[value_idx(engine)];
+        /* Mostly similar points, so that there are both dominated and non-dominated pairs. */
+        for (size_t i = 0; i < dim; i++) rhs[i] = (value_idx(engine) < 6) ? lhs[i] : values[value_idx(engine)];
+
+        REQUIRE(paretoCompareLess(lhs, rhs) == reference_less(lhs, rhs));
+        REQUIRE(paretoCompareLess(rhs, lhs) == reference_less(rhs, lhs));
+        REQUIRE(paretoCompare(lhs, rhs) == reference_three_way(lhs, rhs));
+
+        const bool block_dominates = paretoDominatedByAny(lhs, block);
+        bool expected = false;
+        for (size_t row = 0; row < block.size(); row += dim)
+        {
+            expected |= reference_less(lhs, std::span(block).subspan(row, dim));
+        }
+        REQUIRE(block_dominates == expected);
+
+        if (n % 50 == 0) block.clear();
+        block.insert(block.end(), rhs.begin(), rhs.end());
+    }
+}
+
 TEST_CASE("euclidean_norm", "[math]")
 {
     REQUIRE(euclideanNorm({}) == 0.0);
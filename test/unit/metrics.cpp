@@ -3,14 +3,19 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include "encoding/binary.hpp"
 #include "metrics/metrics.hpp"
+#include "metrics/pop_stats.hpp"
 #include "utility/functional.hpp"
 #include "test_utils.hpp"
 #include <algorithm>
+#include <random>
+#include <cmath>
 
 using namespace gapp;
 using namespace gapp::metrics;
+using Catch::Approx;
 
 constexpr static size_t num_obj = 3;
 constexpr static size_t num_gen = 5;
@@ -54,6 +59,43 @@ TEST_CASE("nadir_point_metric", "[metrics]")
     REQUIRE(std::all_of(val.begin(), val.end(), detail::equal_to(0.0)));
 }
 
+TEST_CASE("population_statistics", "[metrics]")
+{
+    const size_t nrows = GENERATE(1, 2, 100, 10000);
+
+    std::mt19937 engine(nrows);
+    std::uniform_real_distribution<double> dist(-10.0, 10.0);
+
+    FitnessMatrix fmat(nrows, num_obj);
+    for (auto row : fmat)
+    {
+        for (double& f : row) f = 1E6 + dist(engine);
+    }
+
+    for (size_t col = 0; col < num_obj; col++)
+    {
+        double min = fmat[0][col], max = fmat[0][col], sum = 0.0;
+        for (const auto& row : fmat)
+        {
+            min = std::min(min, row[col]);
+            max = std::max(max, row[col]);
+            sum += row[col];
+        }
+        const double mean = sum / nrows;
+
+        double sum_sq = 0.0;
+        for (const auto& row : fmat) sum_sq += (row[col] - mean) * (row[col] - mean);
+        const double variance = (nrows == 1) ? 0.0 : sum_sq / (nrows - 1.0);
+
+        REQUIRE(detail::minFitness(fmat.begin(), fmat.end())[col] == min);
+        REQUIRE(detail::maxFitness(fmat.begin(), fmat.end())[col] == max);
+        REQUIRE(detail::fitnessMean(fmat.begin(), fmat.end())[col] == Approx(mean).epsilon(1E-12));
+        REQUIRE(detail::fitnessVariance(fmat.begin(), fmat.end())[col] == Approx(variance).epsilon(1E-8));
+        REQUIRE(detail::fitnessVariance(fmat.begin(), fmat.end(), detail::fitnessMean(fmat.begin(), fmat.end()))[col] == Approx(variance).epsilon(1E-8));
+        REQUIRE(detail::fitnessStdDev(fmat.begin(), fmat.end())[col] == Approx(std::sqrt(variance)).epsilon(1E-8));
+    }
+}
+
 TEST_CASE("hypervolume_metric", "[metrics]")
 {
     BinaryGA GA{ popsize };
@@ -80,6 +122,26 @@ TEST_CASE("hypervolume_auto", "[metrics]")
     REQUIRE(std::all_of(metric.begin(), metric.end(), detail::equal_to(0.0)));
 }
 
+TEST_CASE("hypervolume_methods", "[metrics]")
+{
+    const auto method = GENERATE(HypervolumeMethod::Exact, HypervolumeMethod::Incremental, HypervolumeMethod::Approximate);
+
+    BinaryGA GA{ popsize };
+
+    GA.track(Hypervolume{ FitnessVector(num_obj, -10.0), method }, AutoHypervolume{ method });
+    GA.solve(DummyFitnessFunction<BinaryGene>{ 10, num_obj }, num_gen);
+
+    const auto& metric = GA.get_metric<Hypervolume>();
+    const auto& auto_metric = GA.get_metric<AutoHypervolume>();
+
+    REQUIRE(metric.method() == method);
+    REQUIRE(metric.size() == num_gen);
+    REQUIRE(std::all_of(metric.begin(), metric.end(), detail::equal_to(1000.0)));
+
+    REQUIRE(auto_metric.size() == num_gen);
+    REQUIRE(std::all_of(auto_metric.begin(), auto_metric.end(), detail::equal_to(0.0)));
+}
+
 TEST_CASE("fitness_evaluations", "[metrics]")
 {
     BinaryGA GA{ popsize };
@@ -98,4 +160,18 @@ TEST_CASE("fitness_evaluations", "[metrics]")
 
     REQUIRE(metric2.size() == num_gen);
     REQUIRE(std::all_of(metric2.begin(), metric2.end(), detail::equal_to(popsize)));
+}
+
+TEST_CASE("fitness_evaluation_rate", "[metrics]")
+{
+    BinaryGA GA{ popsize };
+
+    GA.track(FitnessEvaluationRate{});
+    GA.solve(DummyFitnessFunction<BinaryGene>{ 10, num_obj, FitnessFunctionInfo::Type::Dynamic }, num_gen);
+
+    const auto& metric = GA.get_metric<FitnessEvaluationRate>();
+
+    REQUIRE(metric.size() == num_gen);
+    REQUIRE(metric[0] == 0.0);
+    REQUIRE(std::all_of(metric.begin(), metric.end(), detail::greater_eq_than(0.0)));
 }
\ No newline at end of file
@@ -0,0 +1,108 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "gapp.hpp"
+#include "algorithm/moead.hpp"
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <cstddef>
+
+using namespace gapp;
+using namespace gapp::algorithm::dtl;
+using Catch::Approx;
+
+TEST_CASE("moead_neighbourhoods", "[moead]")
+{
+    const FitnessMatrix weights = {
+        { 0.0,  1.0  },
+        { 0.25, 0.75 },
+        { 0.5,  0.5  },
+        { 0.75, 0.25 },
+        { 1.0,  0.0  },
+    };
+
+    const auto neighbourhoods = findNeighbourhoods(weights, 3);
+
+    REQUIRE(neighbourhoods.size() == weights.size());
+
+    for (size_t i = 0; i < neighbourhoods.size(); i++)
+    {
+        REQUIRE(neighbourhoods[i].size() == 3);
+        REQUIRE(neighbourhoods[i][0] == i);
+    }
+
+    auto sorted = [](small_vector<size_t> neighbours) { std::sort(neighbours.begin(), neighbours.end()); return neighbours; };
+
+    REQUIRE(sorted(neighbourhoods[0]) == small_vector<size_t>{ 0, 1, 2 });
+    REQUIRE(sorted(neighbourhoods[1]) == small_vector<size_t>{ 0, 1, 2 });
+    REQUIRE(sorted(neighbourhoods[2]) == small_vector<size_t>{ 1, 2, 3 });
+    REQUIRE(sorted(neighbourhoods[3]) == small_vector<size_t>{ 2, 3, 4 });
+    REQUIRE(sorted(neighbourhoods[4]) == small_vector<size_t>{ 2, 3, 4 });
+
+    /* The neighbourhoods can't be larger than the number of weight vectors. */
+    const auto all_neighbours = findNeighbourhoods(weights, 10);
+    REQUIRE(std::all_of(all_neighbours.begin(), all_neighbours.end(), [&](const auto& neighbours) { return neighbours.size() == weights.size(); }));
+}
+
+TEST_CASE("moead_tchebycheff", "[moead]")
+{
+    const FitnessVector ideal_point = { 1.0, 1.0 };
+    const FitnessVector nadir_point = { 0.0, 0.0 };
+
+    REQUIRE(tchebycheff(FitnessVector{ 0.5, 0.8 }, FitnessVector{ 0.3, 0.7 }, ideal_point, nadir_point) == Approx(0.15));
+    REQUIRE(tchebycheff(FitnessVector{ 0.5, 0.8 }, FitnessVector{ 0.0, 1.0 }, ideal_point, nadir_point) == Approx(0.2));
+    REQUIRE(tchebycheff(FitnessVector{ 1.0, 1.0 }, FitnessVector{ 0.5, 0.5 }, ideal_point, nadir_point) == Approx(0.0).margin(1E-12));
+
+    /* The distances are normalized using the ideal and nadir points. */
+    REQUIRE(tchebycheff(FitnessVector{ 1.0, 2.0 }, FitnessVector{ 0.5, 0.5 }, FitnessVector{ 2.0, 4.0 }, nadir_point) == Approx(0.25));
+}
+
+TEST_CASE("moead_pbi", "[moead]")
+{
+    const FitnessVector ideal_point = { 1.0, 1.0 };
+    const FitnessVector nadir_point = { 0.0, 0.0 };
+    const FitnessVector direction = { 1.0 / std::sqrt(2.0), 1.0 / std::sqrt(2.0) };
+
+    /* A point along the direction doesn't have a penalty. */
+    REQUIRE(pbi(FitnessVector{ 0.6, 0.6 }, direction, ideal_point, nadir_point) == Approx(0.4 * std::sqrt(2.0)));
+
+    const double d1 = 0.7 / std::sqrt(2.0);
+    const double d2 = 0.15 * std::sqrt(2.0);
+    REQUIRE(pbi(FitnessVector{ 0.5, 0.8 }, direction, ideal_point, nadir_point) == Approx(d1 + 5.0 * d2));
+}
+
+TEST_CASE("moead_replacement_limit", "[moead]")
+{
+    const problems::DTLZ2 f{ 3, 12 };
+    constexpr size_t popsize = 20;
+
+    RCGA GA{ popsize };
+    GA.algorithm(algorithm::MOEAD{});
+    GA.solve(f, f.bounds(), 5);
+
+    algorithm::MOEAD moead;
+    moead.initialize(GA);
+
+    Population<RealGene> parents = GA.population();
+    Population<RealGene> children = GA.population();
+
+    /* The first child is better than every current solution for every subproblem, while the rest are worse than all of them. */
+    for (size_t i = 0; i < children.size(); i++)
+    {
+        children[i].chromosome[0] += 10.0;
+        children[i].fitness.assign(f.num_objectives(), (i == 0) ? 10.0 : -10.0);
+    }
+
+    moead.nextPopulation(GA, parents, children);
+
+    REQUIRE(parents.size() == popsize);
+
+    /* A child can only replace the solution of a single subproblem. */
+    const auto best_count = std::count_if(parents.begin(), parents.end(), [](const Candidate<RealGene>& sol) { return sol.fitness[0] == 10.0; });
+    const auto worst_count = std::count_if(parents.begin(), parents.end(), [](const Candidate<RealGene>& sol) { return sol.fitness[0] == -10.0; });
+
+    REQUIRE(best_count == 1);
+    REQUIRE(worst_count == 0);
+}
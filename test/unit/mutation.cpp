@@ -230,3 +230,45 @@ TEMPLATE_TEST_CASE("integer_mutation", "[mutation]", integer::Uniform)
         std::all_of(candidate.chromosome.begin(), candidate.chromosome.end(), detail::between(bounds.lower(), bounds.upper()))
     );
 }
+
+TEMPLATE_TEST_CASE("mutation_gene_changes", "[mutation]", perm::Swap2, perm::Swap3)
+{
+    using Mutation = TestType;
+
+    PermutationGA context;
+    context.solve(DummyFitnessFunction<PermutationGene>(10), 1);
+
+    constexpr Mutation mutation{ 1.0 };
+
+    Candidate<PermutationGene> candidate{ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 } };
+    candidate.fitness = { 1.0 };
+
+    SECTION("evaluated")
+    {
+        mutation(context, candidate);
+
+        const size_t changed_genes = std::count_if(candidate.begin(), candidate.end(), [idx = 0_sz](size_t gene) mutable { return gene != idx++; });
+
+        REQUIRE(!candidate.is_evaluated());
+        REQUIRE(candidate.changes.parent_fitness == FitnessVector{ 1.0 });
+        REQUIRE(candidate.changes.genes.size() == changed_genes);
+
+        for (size_t i = 0; i < candidate.changes.genes.size(); i++)
+        {
+            const auto [idx, old_value] = candidate.changes.genes[i];
+
+            REQUIRE(old_value == idx);
+            REQUIRE(candidate.chromosome[idx] != old_value);
+            REQUIRE((i == 0 || candidate.changes.genes[i - 1].index < idx));
+        }
+    }
+
+    SECTION("unevaluated")
+    {
+        candidate.fitness.clear();
+
+        mutation(context, candidate);
+
+        REQUIRE(candidate.changes.empty());
+    }
+}
@@ -2,9 +2,11 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include <catch2/matchers/catch_matchers_all.hpp>
 #include "algorithm/nd_sort.hpp"
 #include "utility/math.hpp"
+#include "utility/rng.hpp"
 #include "utility/utility.hpp"
 #include <vector>
 #include <algorithm>
@@ -40,7 +42,7 @@ const FitnessMatrix fmat = {
     {  2.9, 0.9  },  // p4 - 18 ~
 };
 
-TEMPLATE_TEST_CASE_SIG("nd_sort", "[pareto_front]", ((auto F), F), fastNonDominatedSort, dominanceDegreeSort, efficientNonDominatedSort)
+TEMPLATE_TEST_CASE_SIG("nd_sort", "[pareto_front]", ((auto F), F), fastNonDominatedSort, dominanceDegreeSort, efficientNonDominatedSort, efficientNonDominatedSortBS, twoObjectiveNonDominatedSort)
 {
     std::vector<FrontElement> pareto_fronts = F(fmat.begin(), fmat.end());
 
@@ -84,6 +86,69 @@ TEMPLATE_TEST_CASE_SIG("nd_sort", "[pareto_front]", ((auto F), F), fastNonDomina
     REQUIRE_THAT(pareto_fronts_approx, Matchers::UnorderedEquals(expected_fronts));
 }
 
+TEST_CASE("nd_sort_random", "[pareto_front]")
+{
+    const size_t num_obj = GENERATE(1, 2, 3, 6);
+    const size_t popsize = GENERATE(10, 300);
+
+    FitnessMatrix random_fmat(popsize, num_obj);
+    for (auto row : random_fmat)
+    {
+        /* Correlated objectives, so there are many fronts. */
+        const double base = rng::randomReal();
+        for (double& val : row) val = base + 0.1 * rng::randomReal();
+    }
+
+    const auto expected_ranks = ParetoFronts(fastNonDominatedSort(random_fmat.begin(), random_fmat.end())).ranks();
+
+    REQUIRE(ParetoFronts(efficientNonDominatedSort(random_fmat.begin(), random_fmat.end())).ranks() == expected_ranks);
+    REQUIRE(ParetoFronts(efficientNonDominatedSortBS(random_fmat.begin(), random_fmat.end())).ranks() == expected_ranks);
+    REQUIRE(nonDominatedSort(random_fmat).ranks() == expected_ranks);
+
+    if (num_obj == 2)
+    {
+        REQUIRE(ParetoFronts(twoObjectiveNonDominatedSort(random_fmat.begin(), random_fmat.end())).ranks() == expected_ranks);
+    }
+}
+
+TEST_CASE("nd_sort_incremental", "[pareto_front]")
+{
+    const size_t num_obj = GENERATE(2, 3, 6);
+    const size_t popsize = 100;
+
+    auto random_point = [&]
+    {
+        const double base = rng::randomReal();
+        std::vector<double> point(num_obj);
+        for (double& val : point) val = base + 0.1 * rng::randomReal();
+        return point;
+    };
+
+    FitnessMatrix fmat;
+    for (size_t i = 0; i < 2 * popsize; i++) fmat.append_row(random_point());
+
+    IncrementalNdSort nd_sort;
+
+    for (size_t gen = 0; gen < 5; gen++)
+    {
+        auto pareto_fronts = nd_sort.sort(fmat);
+        REQUIRE(pareto_fronts.ranks() == nonDominatedSort(fmat).ranks());
+
+        pareto_fronts.resize(popsize);
+        nd_sort.update(fmat, pareto_fronts);
+
+        FitnessMatrix next_fmat;
+        for (const auto& [idx, _] : pareto_fronts) next_fmat.append_row(fmat[idx]);
+        for (size_t i = 0; i < popsize; i++) next_fmat.append_row(random_point());
+
+        fmat = std::move(next_fmat);
+    }
+
+    /* The survivors were changed, so their ranks can't be reused. */
+    fmat[0] = random_point();
+    REQUIRE(nd_sort.sort(fmat).ranks() == nonDominatedSort(fmat).ranks());
+}
+
 TEST_CASE("pareto_fronts", "[pareto_front]")
 {
     ParetoFronts pareto_fronts = nonDominatedSort(fmat.begin(), fmat.end());
@@ -0,0 +1,98 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include "gapp.hpp"
+#include "algorithm/nd_sort.hpp"
+#include "utility/serialization.hpp"
+#include "utility/math.hpp"
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <cstddef>
+
+using namespace gapp;
+using namespace gapp::algorithm::dtl;
+
+class LinearObjectives final : public FitnessFunctionBase<RealGene>
+{
+public:
+    explicit LinearObjectives(size_t num_obj) :
+        FitnessFunctionBase<RealGene>(4), num_obj_(num_obj)
+    {}
+
+private:
+    FitnessVector invoke(const Candidate<RealGene>& sol) const override
+    {
+        /* Every objective depends on every gene, so ties are unlikely even with genes clamped to the bounds. */
+        constexpr double weights[3][4] = { { 1.0, 0.3, -0.7, 0.2 }, { -0.4, 1.0, 0.6, -0.9 }, { 0.8, -0.5, 1.0, 0.35 } };
+
+        FitnessVector fvec(num_obj_, 0.0);
+        for (size_t obj = 0; obj < num_obj_; obj++)
+        {
+            for (size_t i = 0; i < sol.chromosome.size(); i++) fvec[obj] += weights[obj][i] * sol.chromosome[i];
+        }
+        return fvec;
+    }
+
+    size_t num_obj_;
+};
+
+/* The crowding distance calculation of the original NSGA-II algorithm, used as the reference. */
+static std::vector<double> referenceCrowdingDistances(const FitnessMatrix& fmat)
+{
+    ParetoFronts pareto_fronts = nonDominatedSort(fmat);
+    std::vector<double> distances(fmat.size(), 0.0);
+
+    for (const ParetoFrontsRange& front : pareto_fronts.fronts())
+    {
+        std::vector<size_t> order;
+        for (const FrontElement& sol : front) order.push_back(sol.idx);
+
+        for (size_t obj = 0; obj < fmat.ncols(); obj++)
+        {
+            std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) { return fmat(lhs, obj) < fmat(rhs, obj); });
+
+            const double finterval = std::max(fmat(order.back(), obj) - fmat(order.front(), obj), 1E-8);
+
+            distances[order.front()] = math::inf<double>;
+            distances[order.back()]  = math::inf<double>;
+
+            for (size_t i = 1; i + 1 < order.size(); i++)
+            {
+                distances[order[i]] += (fmat(order[i + 1], obj) - fmat(order[i - 1], obj)) / finterval;
+            }
+        }
+    }
+
+    return distances;
+}
+
+TEST_CASE("nsga2_crowding_distances", "[nsga2]")
+{
+    const size_t num_obj = GENERATE(2, 3);
+
+    RCGA GA{ 50, algorithm::NSGA2{} };
+    GA.crossover_method(crossover::real::SimulatedBinary{ 1.0 });
+    GA.mutation_method(mutation::real::Gauss{ 1.0 });
+
+    GA.solve(LinearObjectives{ num_obj }, Bounds{ -1.0, 1.0 }, 5);
+
+    detail::binary_writer out;
+    GA.algorithm().saveState(out);
+
+    detail::binary_reader in(out.data());
+    std::ignore = in.read_array<size_t>();
+    const auto distances = in.read_array<double>();
+
+    /* The distances used by the selections belong to the candidates of the current population. */
+    const auto reference = referenceCrowdingDistances(GA.fitness_matrix());
+
+    REQUIRE(distances.size() == reference.size());
+
+    for (size_t i = 0; i < reference.size(); i++)
+    {
+        REQUIRE(std::isinf(distances[i]) == std::isinf(reference[i]));
+        if (!std::isinf(reference[i])) REQUIRE(std::abs(distances[i] - reference[i]) < 1E-10);
+    }
+}
@@ -0,0 +1,124 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include "core/pareto_archive.hpp"
+#include "core/population.hpp"
+#include "encoding/gene_types.hpp"
+#include "utility/math.hpp"
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <cmath>
+#include <cstddef>
+
+using namespace gapp;
+using namespace gapp::detail;
+
+static Candidates<RealGene> randomCandidates(size_t count, size_t nobj, std::mt19937& engine)
+{
+    static size_t id = 0;
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+    Candidates<RealGene> sols(count);
+    for (auto& sol : sols)
+    {
+        sol.chromosome = { double(id++) };
+        sol.fitness.resize(nobj);
+        for (double& f : sol.fitness) f = std::round(10.0 * dist(engine)) / 10.0;
+    }
+    return sols;
+}
+
+static std::vector<Chromosome<RealGene>> sortedChromosomes(const Candidates<RealGene>& sols)
+{
+    std::vector<Chromosome<RealGene>> chroms;
+    for (const auto& sol : sols) chroms.push_back(sol.chromosome);
+    std::sort(chroms.begin(), chroms.end());
+    return chroms;
+}
+
+static bool chromosomeLess(const Candidate<RealGene>& lhs, const Candidate<RealGene>& rhs)
+{
+    return lhs.chromosome < rhs.chromosome;
+}
+
+TEST_CASE("pareto_archive_insert", "[pareto_archive]")
+{
+    const size_t nobj = GENERATE(1, 2, 3, 5);
+    math::ScopedTolerances _(0.0, 0.0);
+
+    std::mt19937 engine(nobj);
+
+    ParetoArchive<RealGene> archive;
+    Candidates<RealGene> all_sols;
+
+    for (size_t batch = 0; batch < 20; batch++)
+    {
+        auto sols = randomCandidates(100, nobj, engine);
+        all_sols.insert(all_sols.end(), sols.begin(), sols.end());
+        archive.insert(std::move(sols));
+
+        /* Every chromosome is unique, so the archive should contain the pareto front of every candidate inserted so far. */
+        REQUIRE(sortedChromosomes(archive.solutions()) == sortedChromosomes(findParetoFront(all_sols)));
+
+        /* The order of the solutions is deterministic. */
+        REQUIRE(std::is_sorted(archive.solutions().begin(), archive.solutions().end(), chromosomeLess));
+    }
+}
+
+TEST_CASE("pareto_archive_duplicates", "[pareto_archive]")
+{
+    ParetoArchive<RealGene> archive;
+
+    Candidate<RealGene> sol{ 1.0, 2.0 };
+    sol.fitness = { 1.0, 1.0 };
+
+    REQUIRE(archive.insert(sol));
+    REQUIRE(!archive.insert(sol));
+
+    sol.chromosome = { 2.0, 1.0 };
+    REQUIRE(archive.insert(sol));
+    REQUIRE(archive.size() == 2);
+
+    sol.chromosome = { 3.0, 3.0 };
+    sol.fitness = { 2.0, 1.0 };
+    REQUIRE(archive.insert(sol));
+    REQUIRE(archive.size() == 1);
+
+    archive.clear();
+    REQUIRE(archive.empty());
+}
+
+TEST_CASE("pareto_archive_max_size", "[pareto_archive]")
+{
+    std::mt19937 engine(0);
+
+    ParetoArchive<RealGene> archive(10);
+
+    for (size_t i = 0; i < 10; i++)
+    {
+        Candidates<RealGene> sols(50);
+        for (size_t j = 0; j < sols.size(); j++)
+        {
+            /* Points on a linear front, none of them dominates another. */
+            const double x = std::uniform_real_distribution<double>(0.0, 1.0)(engine);
+            sols[j].chromosome = { x };
+            sols[j].fitness = { x, 1.0 - x };
+        }
+        archive.insert(std::move(sols));
+
+        REQUIRE(archive.size() == 10);
+        REQUIRE(std::is_sorted(archive.solutions().begin(), archive.solutions().end(), chromosomeLess));
+    }
+
+    archive.max_size(5);
+    REQUIRE(archive.size() == 5);
+
+    archive.max_size(0);
+    Candidate<RealGene> sol{ 2.0 };
+    sol.fitness = { 2.0, -1.0 };
+
+    archive.insert(std::move(sol));
+    REQUIRE(archive.size() == 6);
+}
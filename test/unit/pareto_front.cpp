@@ -6,7 +6,10 @@
 #include "core/population.hpp"
 #include "utility/small_vector.hpp"
 #include "utility/utility.hpp"
+#include <algorithm>
+#include <random>
 #include <vector>
+#include <cmath>
 
 using namespace gapp;
 using namespace gapp::detail;
@@ -45,7 +48,7 @@ TEST_CASE("find_pareto_front_1D", "[pareto_front]")
     }
 }
 
-TEMPLATE_TEST_CASE_SIG("find_pareto_front_nd", "[pareto_front]", ((auto F), F), findParetoFrontSort, findParetoFrontBest, findParetoFrontKung)
+TEMPLATE_TEST_CASE_SIG("find_pareto_front_nd", "[pareto_front]", ((auto F), F), findParetoFrontSort, findParetoFrontBest, findParetoFrontKung, findParetoFrontKungParallel)
 {
     FitnessMatrix fmat = {
         { 0.0,   0.0  },
@@ -91,4 +94,26 @@ TEMPLATE_TEST_CASE_SIG("find_pareto_front_nd", "[pareto_front]", ((auto F), F),
 
         REQUIRE_THAT(optimal_indices, Matchers::UnorderedEquals(std::vector<size_t>{ 4, 5, 9, 11, 12, 13, 14 }));
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("find_pareto_front_parallel", "[pareto_front]")
+{
+    const size_t num_obj = GENERATE(2, 3, 5);
+    const size_t popsize = GENERATE(100, 5000);
+
+    ScopedTolerances _(0.0, 0.0);
+
+    std::mt19937 engine(num_obj * popsize);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+    FitnessMatrix fmat(popsize, num_obj);
+    for (const auto& row : fmat)
+    {
+        for (double& val : row) { val = std::round(100.0 * dist(engine)) / 100.0; }
+    }
+
+    auto expected = findParetoFrontBest(fmat).std_vec();
+    auto optimal_indices = findParetoFrontKungParallel(fmat).std_vec();
+
+    REQUIRE_THAT(optimal_indices, Matchers::UnorderedEquals(expected));
+}
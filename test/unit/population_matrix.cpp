@@ -0,0 +1,87 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#include <catch2/catch_test_macros.hpp>
+#include "core/population_matrix.hpp"
+#include "core/population.hpp"
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+using namespace gapp;
+
+TEST_CASE("population_matrix_empty", "[population_matrix]")
+{
+    PopulationMatrix<int> pmat;
+
+    REQUIRE(pmat.empty());
+    REQUIRE(pmat.size() == 0);
+    REQUIRE(pmat.chrom_len() == 0);
+
+    pmat.assign(Population<int>{});
+    REQUIRE(pmat.empty());
+    REQUIRE(pmat.chromosomes().empty());
+}
+
+TEST_CASE("population_matrix_assign", "[population_matrix]")
+{
+    Population<int> pop = { Candidate<int>{ 1, 2, 3 }, Candidate<int>{ 4, 5, 6 }, Candidate<int>{ 7, 8, 9 } };
+
+    SECTION("unevaluated")
+    {
+        const PopulationMatrix<int> pmat{ pop };
+
+        REQUIRE(pmat.size() == 3);
+        REQUIRE(pmat.chrom_len() == 3);
+        REQUIRE(pmat.chromosomes() == detail::Matrix<int>{ { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } });
+        REQUIRE(pmat.fitness_matrix().empty());
+        REQUIRE(pmat.cv_matrix().empty());
+
+        for (size_t i = 0; i < pop.size(); i++)
+        {
+            REQUIRE(std::equal(pmat[i].begin(), pmat[i].end(), pop[i].begin(), pop[i].end()));
+            REQUIRE(!pmat[i].is_evaluated());
+            REQUIRE(pmat[i].num_constraints() == 0);
+        }
+    }
+
+    SECTION("evaluated")
+    {
+        for (Candidate<int>& sol : pop)
+        {
+            sol.fitness = { double(sol[0]), double(sol[1]) };
+            sol.constraint_violation = { 0.0 };
+        }
+
+        const PopulationMatrix<int> pmat{ pop };
+
+        REQUIRE(pmat.fitness_matrix() == FitnessMatrix{ { 1.0, 2.0 }, { 4.0, 5.0 }, { 7.0, 8.0 } });
+        REQUIRE(pmat.cv_matrix() == CVMatrix{ { 0.0 }, { 0.0 }, { 0.0 } });
+
+        REQUIRE(pmat[1].num_objectives() == 2);
+        REQUIRE(pmat[1].fitness[1] == 5.0);
+        REQUIRE(pmat[2].constraint_violation[0] == 0.0);
+    }
+
+    SECTION("partially evaluated")
+    {
+        pop[0].fitness = { 1.0 };
+
+        const PopulationMatrix<int> pmat{ pop };
+
+        REQUIRE(pmat.chromosomes().nrows() == 3);
+        REQUIRE(pmat.fitness_matrix().empty());
+        REQUIRE(!pmat[0].is_evaluated());
+    }
+
+    SECTION("pointers")
+    {
+        const std::vector<const Candidate<int>*> sols = { &pop[2], &pop[0] };
+
+        PopulationMatrix<int> pmat{ pop };
+        pmat.assign(sols);
+
+        REQUIRE(pmat.size() == 2);
+        REQUIRE(pmat.chromosomes() == detail::Matrix<int>{ { 7, 8, 9 }, { 1, 2, 3 } });
+        REQUIRE(pmat[1].chromosome[2] == 3);
+    }
+}
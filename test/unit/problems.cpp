@@ -5,6 +5,7 @@
 #include "utility/math.hpp"
 #include "utility/rng.hpp"
 #include <algorithm>
+#include <numeric>
 #include <vector>
 #include <cstddef>
 
@@ -50,6 +51,51 @@ TEMPLATE_TEST_CASE("single_objective_problems", "[problems]", Sphere, Rastrigin,
     REQUIRE( !paretoCompareLess(func.optimal_value(), func(random_sol)) );
 }
 
+TEMPLATE_TEST_CASE("delta_evaluation", "[problems]", Sphere, Rastrigin)
+{
+    TestType func(100);
+
+    Candidate<RealGene> sol = randomSolution(func.bounds());
+    const FitnessVector parent_fitness = func(sol);
+
+    std::vector<GeneChange<RealGene>> changes;
+    for (size_t idx : { 3, 4, 50, 99 })
+    {
+        changes.push_back({ idx, sol[idx] });
+        sol[idx] = randomReal(func.bounds()[idx].lower(), func.bounds()[idx].upper());
+    }
+
+    REQUIRE_THAT( func.evaluate_delta(parent_fitness, sol, changes).std_vec(), Approx(func(sol).std_vec()).margin(1E-8) );
+}
+
+TEST_CASE("tsp_delta_evaluation", "[problems]")
+{
+    TSP52 func;
+
+    Candidate<PermutationGene> sol{ Chromosome<PermutationGene>(func.num_vars()) };
+    std::iota(sol.begin(), sol.end(), 0);
+
+    const FitnessVector parent_fitness = func(sol);
+
+    SECTION("swap")
+    {
+        std::vector<GeneChange<PermutationGene>> changes{ { 0, sol[0] }, { 7, sol[7] }, { 8, sol[8] }, { 50, sol[50] } };
+        std::swap(sol[0], sol[8]);
+        std::swap(sol[7], sol[50]);
+
+        REQUIRE_THAT( func.evaluate_delta(parent_fitness, sol, changes).std_vec(), Approx(func(sol).std_vec()).margin(1E-8) );
+    }
+
+    SECTION("inversion")
+    {
+        std::vector<GeneChange<PermutationGene>> changes;
+        for (size_t idx = 10; idx < 20; idx++) changes.push_back({ idx, sol[idx] });
+        std::reverse(sol.begin() + 10, sol.begin() + 20);
+
+        REQUIRE_THAT( func.evaluate_delta(parent_fitness, sol, changes).std_vec(), Approx(func(sol).std_vec()).margin(1E-8) );
+    }
+}
+
 TEST_CASE("kursawe", "[problems]")
 {
     const size_t var_count = GENERATE(2, 10, 100, 1000);
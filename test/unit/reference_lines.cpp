@@ -9,6 +9,11 @@
 #include <algorithm>
 #include <numeric>
 #include <vector>
+#include <fstream>
+#include <filesystem>
+#include <stdexcept>
+#include <cstring>
+#include <cstdint>
 #include <cstddef>
 
 using Catch::Approx;
@@ -56,4 +61,85 @@ TEMPLATE_TEST_CASE_SIG("reference_lines_subset", "[pareto_front]", ((auto F), F)
         REQUIRE(std::accumulate(point.begin(), point.end(), 0.0) == Approx(1.0).margin(1E-4));
         REQUIRE(std::all_of(point.begin(), point.end(), greater_eq_than(0.0)));
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("reference_lines_cache", "[pareto_front]")
+{
+    clearCache();
+
+    size_t generator_calls = 0;
+    auto gen = cached("test_mirror", [&](size_t dim, size_t num_points) { generator_calls++; return quasirandomSimplexPointsMirror(dim, num_points); });
+
+    REQUIRE(gen(3, 10) == quasirandomSimplexPointsMirror(3, 10));
+    REQUIRE(gen(3, 10) == quasirandomSimplexPointsMirror(3, 10));
+    REQUIRE(generator_calls == 1);
+
+    REQUIRE(gen(4, 10).size() == 10);
+    REQUIRE(generator_calls == 2);
+
+    const auto path = std::filesystem::temp_directory_path() / "gapp_reflines.cache";
+    saveCache(path);
+    clearCache();
+
+    REQUIRE(gen(3, 10) == quasirandomSimplexPointsMirror(3, 10));
+    REQUIRE(generator_calls == 3);
+
+    clearCache();
+    loadCache(path);
+
+    REQUIRE(gen(3, 10) == quasirandomSimplexPointsMirror(3, 10));
+    REQUIRE(gen(4, 10) == quasirandomSimplexPointsMirror(4, 10));
+    REQUIRE(generator_calls == 3);
+
+    std::ofstream{ path } << "not a cache file";
+    REQUIRE_THROWS_AS(loadCache(path), std::runtime_error);
+
+    /* A point set whose nrows * ncols overflows to the number of values in the file. */
+    clearCache();
+    REQUIRE(gen(2, 2).size() == 2);
+    saveCache(path);
+
+    std::vector<char> data(std::filesystem::file_size(path));
+    std::ifstream{ path, std::ios::binary }.read(data.data(), data.size());
+
+    const std::uint64_t header[4] = { 2, 2, 2, 2 };
+    const char* header_bytes = reinterpret_cast<const char*>(header);
+    const auto header_pos = std::search(data.begin(), data.end(), header_bytes, header_bytes + sizeof(header));
+    REQUIRE(header_pos != data.end());
+
+    const std::uint64_t nrows = (std::uint64_t(1) << 63) + 2;
+    std::memcpy(&*header_pos + 2 * sizeof(std::uint64_t), &nrows, sizeof(nrows));
+    std::ofstream{ path, std::ios::binary | std::ios::trunc }.write(data.data(), data.size());
+
+    REQUIRE_THROWS_AS(loadCache(path), std::runtime_error);
+
+    std::filesystem::remove(path);
+    clearCache();
+}
+
+TEST_CASE("reference_lines_cache_shape", "[pareto_front]")
+{
+    clearCache();
+
+    /* The generators don't have to return the number of points requested from them. */
+    size_t generator_calls = 0;
+    auto gen = cached("test_shape", [&](size_t dim, size_t num_points) { generator_calls++; return quasirandomSimplexPointsMirror(dim, num_points / 2); });
+    auto empty_gen = cached("test_empty", [&](size_t, size_t) { generator_calls++; return FitnessMatrix{}; });
+
+    const FitnessMatrix points = gen(3, 10);
+    REQUIRE(points.nrows() == 5);
+    REQUIRE(empty_gen(0, 4).empty());
+    REQUIRE(generator_calls == 2);
+
+    const auto path = std::filesystem::temp_directory_path() / "gapp_reflines_shape.cache";
+    saveCache(path);
+    clearCache();
+    loadCache(path);
+
+    REQUIRE(gen(3, 10) == points);
+    REQUIRE(empty_gen(0, 4).empty());
+    REQUIRE(generator_calls == 2);
+
+    std::filesystem::remove(path);
+    clearCache();
+}
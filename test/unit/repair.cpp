@@ -2,6 +2,7 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <atomic>
+#include <cmath>
 #include "gapp.hpp"
 #include "test_utils.hpp"
 
@@ -34,3 +35,28 @@ TEST_CASE("repair_function", "[repair_function]")
 
     REQUIRE(repair_count == population_size * generation_count);
 }
+
+TEST_CASE("repair_delta_evaluation", "[repair_function]")
+{
+    constexpr size_t population_size = 40;
+    constexpr size_t generation_count = 10;
+
+    RCGA ga{ population_size };
+    ga.crossover_rate(0.0);
+    ga.mutation_rate(0.1);
+
+    ga.repair_function([](const GA<RealGene>&, const Candidate<RealGene>&, Chromosome<RealGene>& chrom)
+    {
+        chrom.back() /= 2.0;
+        return true;
+    });
+
+    /* The repaired chromosomes can't be evaluated using the changes made by the mutation. */
+    const problems::Sphere f{ 10 };
+    ga.solve(f, f.bounds(), generation_count);
+
+    for (const auto& sol : ga.population())
+    {
+        REQUIRE(std::abs(sol.fitness[0] - f(sol)[0]) < 1E-10);
+    }
+}
@@ -1,11 +1,33 @@
-/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
 #include <thread>
+#include <memory>
+#include <type_traits>
+#include <chrono>
 #include "gapp.hpp"
 
 using namespace gapp;
 
+class NoisySphere final : public FitnessFunctionBase<RealGene>
+{
+public:
+    NoisySphere() : FitnessFunctionBase<RealGene>(3, FitnessFunctionInfo::Type::Dynamic) {}
+
+private:
+    FitnessVector invoke(const Candidate<RealGene>& sol) const override
+    {
+        /* The evaluation times vary, so the candidates would be evaluated on different threads with dynamic scheduling. */
+        const double noise = rng::randomReal();
+        std::this_thread::sleep_for(std::chrono::microseconds(int(100 * noise)));
+
+        double fx = noise;
+        for (double x : sol.chromosome) fx -= x * x;
+        return { fx };
+    }
+};
+
 TEST_CASE("reproducibility_single_thread", "[reproducibility]")
 {
     RCGA ga{ 10 };
@@ -24,6 +46,21 @@ TEST_CASE("reproducibility_single_thread", "[reproducibility]")
     execution_threads(std::thread::hardware_concurrency());
 }
 
+TEST_CASE("reproducibility_stochastic_fitness", "[reproducibility]")
+{
+    /* The fitness function uses the random number generators of the evaluating threads in the per-thread mode. */
+    RCGA ga{ 20 };
+    ga.thread_pool(std::make_shared<ThreadPool>(4));
+
+    rng::prng.seed(0x9e3779b97f4a7c15);
+    const auto solutions1 = ga.solve(NoisySphere{}, Bounds{ -1.0, 1.0 }, 10);
+
+    rng::prng.seed(0x9e3779b97f4a7c15);
+    const auto solutions2 = ga.solve(NoisySphere{}, Bounds{ -1.0, 1.0 }, 10);
+
+    REQUIRE(solutions1 == solutions2);
+}
+
 TEST_CASE("reproducibility_multi_thread", "[reproducibility]")
 {
     RCGA ga{ 10 };
@@ -39,3 +76,124 @@ TEST_CASE("reproducibility_multi_thread", "[reproducibility]")
 
     REQUIRE(solutions1 == solutions2);
 }
+
+TEST_CASE("reproducibility_island_model", "[reproducibility]")
+{
+    IslandModel<RCGA> ga{ 3, 10 };
+    problems::Sphere f{ 3 };
+
+    ga.topology(MigrationTopology::Random);
+    ga.migration_interval(2);
+
+    execution_threads(std::thread::hardware_concurrency());
+
+    rng::prng.seed(0x9e3779b97f4a7c15);
+    const auto solutions1 = ga.solve(f, f.bounds(), 5);
+
+    rng::prng.seed(0x9e3779b97f4a7c15);
+    const auto solutions2 = ga.solve(f, f.bounds(), 5);
+
+    REQUIRE(solutions1 == solutions2);
+}
+
+TEST_CASE("reproducibility_thread_pool", "[reproducibility]")
+{
+    RCGA ga{ 10 };
+    problems::Sphere f{ 3 };
+
+    ga.thread_pool(std::make_shared<ThreadPool>(3));
+
+    rng::prng.seed(0x9e3779b97f4a7c15);
+    const auto solutions1 = ga.solve(f, f.bounds(), 5);
+
+    rng::prng.seed(0x9e3779b97f4a7c15);
+    const auto solutions2 = ga.solve(f, f.bounds(), 5);
+
+    REQUIRE(solutions1 == solutions2);
+}
+
+TEST_CASE("reproducibility_pinned_thread_pool", "[reproducibility]")
+{
+    RCGA ga{ 10 };
+    problems::Sphere f{ 3 };
+
+    auto pool = std::make_shared<ThreadPool>(3);
+    pool->cpu_affinity(numa_nodes().front().cpus);
+    ga.thread_pool(pool);
+
+    rng::prng.seed(0x9e3779b97f4a7c15);
+    const auto solutions1 = ga.solve(f, f.bounds(), 5);
+
+    rng::prng.seed(0x9e3779b97f4a7c15);
+    const auto solutions2 = ga.solve(f, f.bounds(), 5);
+
+    REQUIRE(solutions1 == solutions2);
+}
+
+TEMPLATE_TEST_CASE("reproducibility_thread_count", "[reproducibility]", RCGA, BinaryGA, PermutationGA)
+{
+    /* The results of the runs only depend on the seed in the counter-based mode, regardless of the number of threads used. */
+    rng::ScopedMode counter_based_mode{ rng::Mode::CounterBased };
+
+    auto run = [](size_t thread_count)
+    {
+        TestType ga{ 20 };
+        ga.thread_pool(std::make_shared<ThreadPool>(thread_count));
+
+        rng::prng.seed(0x9e3779b97f4a7c15);
+
+        if constexpr (std::is_same_v<TestType, RCGA>) return ga.solve(problems::Rastrigin{ 5 }, problems::Rastrigin{ 5 }.bounds(), 10);
+        if constexpr (std::is_same_v<TestType, BinaryGA>) return ga.solve(problems::Rastrigin{ 5 }, 10);
+        if constexpr (std::is_same_v<TestType, PermutationGA>) return ga.solve(problems::TSP52{}, 10);
+    };
+
+    const auto solutions = run(1);
+
+    REQUIRE(run(2) == solutions);
+    REQUIRE(run(3) == solutions);
+    REQUIRE(run(8) == solutions);
+}
+
+TEST_CASE("reproducibility_thread_count_moga", "[reproducibility]")
+{
+    rng::ScopedMode counter_based_mode{ rng::Mode::CounterBased };
+
+    auto run = [](size_t thread_count)
+    {
+        RCGA ga{ 20 };
+        ga.algorithm(algorithm::NSGA3{});
+        ga.thread_pool(std::make_shared<ThreadPool>(thread_count));
+
+        rng::prng.seed(0x9e3779b97f4a7c15);
+
+        return ga.solve(problems::DTLZ2{ 3 }, problems::DTLZ2{ 3 }.bounds(), 10);
+    };
+
+    const auto solutions = run(1);
+
+    REQUIRE(run(2) == solutions);
+    REQUIRE(run(5) == solutions);
+}
+
+TEST_CASE("reproducibility_thread_count_island_model", "[reproducibility]")
+{
+    rng::ScopedMode counter_based_mode{ rng::Mode::CounterBased };
+    detail::scope_exit reset_threads{ [] { execution_threads(std::thread::hardware_concurrency()); } };
+
+    auto run = [](size_t thread_count)
+    {
+        IslandModel<RCGA> ga{ 3, 10 };
+        ga.topology(MigrationTopology::Random);
+        ga.migration_interval(2);
+
+        execution_threads(thread_count);
+        rng::prng.seed(0x9e3779b97f4a7c15);
+
+        return ga.solve(problems::Sphere{ 3 }, problems::Sphere{ 3 }.bounds(), 6);
+    };
+
+    const auto solutions = run(1);
+
+    REQUIRE(run(2) == solutions);
+    REQUIRE(run(4) == solutions);
+}
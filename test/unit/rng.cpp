@@ -7,7 +7,10 @@
 #include "utility/rng.hpp"
 #include "utility/functional.hpp"
 #include <algorithm>
+#include <thread>
+#include <vector>
 #include <limits>
+#include <tuple>
 #include <cstdint>
 
 using namespace gapp;
@@ -171,3 +174,55 @@ TEST_CASE("sample_cdf", "[rng]")
         REQUIRE(idx < cdf1.size());
     }
 }
+
+TEST_CASE("philox_known_answers", "[rng]")
+{
+    /* The known answer tests of the reference implementation (Random123). */
+    using counter_t = Philox4x32::counter_type;
+    using key_t = Philox4x32::key_type;
+
+    REQUIRE(Philox4x32::block(counter_t{ 0, 0, 0, 0 }, key_t{ 0, 0 }) == counter_t{ 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 });
+    REQUIRE(Philox4x32::block(counter_t{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff }, key_t{ 0xffffffff, 0xffffffff }) == counter_t{ 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd });
+    REQUIRE(Philox4x32::block(counter_t{ 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 }, key_t{ 0xa4093822, 0x299f31d0 }) == counter_t{ 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 });
+}
+
+TEST_CASE("counter_based_streams", "[rng]")
+{
+    auto draw = [](size_t index)
+    {
+        StreamScope _{ 0, 1, index, 2 };
+
+        std::vector<double> numbers;
+        for (size_t i = 0; i < 10; i++) numbers.push_back(randomReal());
+        numbers.push_back(randomNormal());
+        numbers.push_back(randomBool());
+
+        return numbers;
+    };
+
+    std::vector<double> numbers;
+    {
+        ScopedMode counter_based_mode{ Mode::CounterBased };
+
+        numbers = draw(0);
+
+        /* The numbers of a stream don't depend on the thread using it, or on the numbers generated before it. */
+        std::vector<double> other_thread_numbers;
+        std::jthread{ [&] { std::ignore = randomNormal(); other_thread_numbers = draw(0); } }.join();
+
+        REQUIRE(other_thread_numbers == numbers);
+        REQUIRE(draw(1) != numbers);
+
+        /* Nested streams restore the outer stream. */
+        {
+            StreamScope _{ 0, 1, 0, 2 };
+            const double first = randomReal();
+            std::ignore = draw(5);
+            REQUIRE(randomReal() == numbers[1]);
+            REQUIRE(first == numbers[0]);
+        }
+    }
+
+    REQUIRE(mode() == Mode::PerThread);
+    REQUIRE(draw(0) != numbers);
+}
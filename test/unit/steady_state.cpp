@@ -0,0 +1,101 @@
+﻿/* Copyright (c) 2024 Krisztián Rugási. Subject to the MIT License. */
+
+#include <catch2/catch_test_macros.hpp>
+#include "gapp.hpp"
+#include "test_utils.hpp"
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <cstddef>
+
+using namespace gapp;
+
+constexpr static size_t num_gen = 10;
+constexpr static size_t popsize = 20;
+
+
+class ThrowingFitnessFunction final : public FitnessFunctionBase<RealGene>
+{
+public:
+    explicit ThrowingFitnessFunction(size_t max_evals) :
+        FitnessFunctionBase<RealGene>(5, FitnessFunctionInfo::Type::Dynamic), max_evals_(max_evals)
+    {}
+
+private:
+    FitnessVector invoke(const Candidate<RealGene>&) const override
+    {
+        if (evals_++ >= max_evals_) GAPP_THROW(std::runtime_error, "Too many evaluations.");
+        return { 0.0 };
+    }
+
+    mutable std::atomic<size_t> evals_ = 0;
+    size_t max_evals_;
+};
+
+
+TEST_CASE("steady_state_generations", "[steady_state]")
+{
+    RCGA GA{ popsize };
+    GA.steady_state(true);
+
+    REQUIRE(GA.steady_state());
+
+    size_t generations = 0;
+    GA.on_generation_end([&](const GaInfo&) { generations++; });
+
+    GA.solve(DummyFitnessFunction<RealGene>{ 5, 1, FitnessFunctionInfo::Type::Dynamic }, Bounds{ -1.0, 1.0 }, num_gen);
+
+    REQUIRE(generations == num_gen);
+    REQUIRE(GA.generation_cntr() == num_gen - 1);
+
+    REQUIRE(GA.population().size() == popsize);
+    REQUIRE(GA.num_fitness_evals() >= num_gen * popsize);
+    REQUIRE(GA.num_fitness_evals() <= num_gen * popsize + execution_threads());
+}
+
+TEST_CASE("steady_state_stop_condition", "[steady_state]")
+{
+    RCGA GA{ popsize };
+    GA.steady_state(true);
+    GA.stop_condition(stopping::FitnessEvals(5 * popsize));
+
+    GA.solve(DummyFitnessFunction<RealGene>{ 5, 1, FitnessFunctionInfo::Type::Dynamic }, Bounds{ -1.0, 1.0 }, 100);
+
+    REQUIRE(GA.generation_cntr() == 4);
+    REQUIRE(GA.num_fitness_evals() >= 5 * popsize);
+    REQUIRE(GA.num_fitness_evals() <= 5 * popsize + execution_threads());
+}
+
+TEST_CASE("steady_state_multi_objective", "[steady_state]")
+{
+    RCGA GA{ popsize, algorithm::NSGA3{} };
+    GA.steady_state(true);
+
+    const auto solutions = GA.solve(DummyFitnessFunction<RealGene>{ 5, 3, FitnessFunctionInfo::Type::Dynamic }, Bounds{ -1.0, 1.0 }, num_gen);
+
+    REQUIRE(GA.population().size() == popsize);
+    REQUIRE(!solutions.empty());
+}
+
+TEST_CASE("steady_state_thread_pool", "[steady_state]")
+{
+    /* The population update of the algorithm contains parallel loops for large populations. */
+    RCGA GA{ 300, algorithm::NSGA3{} };
+    GA.steady_state(true);
+    GA.thread_pool(std::make_shared<ThreadPool>(4));
+
+    const problems::DTLZ2 f{ 3 };
+    const auto solutions = GA.solve(f, f.bounds(), 5);
+
+    REQUIRE(GA.generation_cntr() == 4);
+    REQUIRE(GA.population().size() == 300);
+    REQUIRE(!solutions.empty());
+}
+
+TEST_CASE("steady_state_exception", "[steady_state]")
+{
+    RCGA GA{ popsize };
+    GA.steady_state(true);
+
+    REQUIRE_THROWS(GA.solve(std::make_unique<ThrowingFitnessFunction>(3 * popsize), Bounds{ -1.0, 1.0 }, num_gen));
+}
@@ -1,15 +1,26 @@
 ﻿/* Copyright (c) 2023 Krisztián Rugási. Subject to the MIT License. */
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include <catch2/matchers/catch_matchers_vector.hpp>
 #include "utility/thread_pool.hpp"
+#include "utility/concurrent_queue.hpp"
+#include "utility/work_stealing_deque.hpp"
 #include "utility/iterators.hpp"
+#include "encoding/real.hpp"
+#include "problems/single_objective.hpp"
+#include <algorithm>
 #include <atomic>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <vector>
 #include <numeric>
 #include <thread>
 #include <tuple>
+#include <stdexcept>
 
+using namespace gapp;
 using namespace gapp::detail;
 using namespace Catch::Matchers;
 
@@ -41,6 +52,63 @@ TEST_CASE("concurrent_queue", "[thread-pool]")
     REQUIRE_THAT(output, Equals(input));
 }
 
+TEST_CASE("work_stealing_deque", "[thread-pool]")
+{
+    work_stealing_deque<int> deque(4);
+
+    SECTION("owner")
+    {
+        for (int i = 0; i < 100; i++) deque.push(i);
+        REQUIRE(deque.size() == 100);
+
+        for (int i = 99; i >= 0; i--) REQUIRE(deque.pop() == i);
+        REQUIRE(deque.empty());
+        REQUIRE(!deque.pop().has_value());
+    }
+
+    SECTION("steal")
+    {
+        for (int i = 0; i < 100; i++) deque.push(i);
+
+        for (int i = 0; i < 100; i++) REQUIRE(deque.steal() == i);
+        REQUIRE(deque.empty());
+        REQUIRE(!deque.steal().has_value());
+    }
+
+    SECTION("concurrent")
+    {
+        constexpr int count = 100000;
+
+        std::atomic<bool> done = false;
+        std::vector<int> visit_counts(count);
+
+        auto thief = [&]
+        {
+            while (!done.load() || !deque.empty())
+            {
+                if (auto n = deque.steal()) std::atomic_ref{ visit_counts[*n] }.fetch_add(1);
+            }
+        };
+
+        {
+            std::jthread t1{ thief };
+            std::jthread t2{ thief };
+
+            for (int i = 0; i < count; i++)
+            {
+                deque.push(i);
+                if (i % 3 == 0)
+                {
+                    if (auto n = deque.pop()) std::atomic_ref{ visit_counts[*n] }.fetch_add(1);
+                }
+            }
+            done.store(true);
+        }
+
+        REQUIRE(std::all_of(visit_counts.begin(), visit_counts.end(), [](int n) { return n == 1; }));
+    }
+}
+
 TEST_CASE("parallel_for", "[thread-pool]")
 {
     int n = 0;
@@ -53,6 +121,64 @@ TEST_CASE("parallel_for", "[thread-pool]")
     REQUIRE(n == 200);
 }
 
+TEST_CASE("parallel_for_schedules", "[thread-pool]")
+{
+    const schedule_type schedule = GENERATE(schedule_type::static_blocks, schedule_type::dynamic, schedule_type::guided);
+    const size_t block_size = GENERATE(1, 3, 64);
+
+    std::vector<int> visit_counts(1000);
+
+    parallel_for(iota_iterator(0_sz), iota_iterator(visit_counts.size()), block_size, schedule, [&](size_t i)
+    {
+        std::atomic_ref{ visit_counts[i] }.fetch_add(1, std::memory_order_relaxed);
+    });
+
+    REQUIRE(std::all_of(visit_counts.begin(), visit_counts.end(), [](int n) { return n == 1; }));
+}
+
+TEST_CASE("parallel_reduce", "[thread-pool]")
+{
+    const size_t block_size = GENERATE(1, 7, 100, 5000);
+
+    const auto sum = parallel_reduce(iota_iterator(0_sz), iota_iterator(1000_sz), block_size, 0_sz, std::plus{}, std::plus{});
+    REQUIRE(sum == 999 * 1000 / 2);
+
+    const auto sum_sq = parallel_transform_reduce(iota_iterator(0_sz), iota_iterator(1000_sz), block_size, 1_sz, std::plus{}, [](size_t n) { return n * n; });
+    REQUIRE(sum_sq == 1 + 999 * 1000 * 1999 / 6);
+
+    const auto empty = parallel_reduce(iota_iterator(0_sz), iota_iterator(0_sz), block_size, 3_sz, std::plus{}, std::plus{});
+    REQUIRE(empty == 3);
+}
+
+TEST_CASE("parallel_reduce_determinism", "[thread-pool]")
+{
+    std::vector<double> values(10000);
+    for (size_t i = 0; i < values.size(); i++) values[i] = 1.0 / (i + 1.0) * ((i % 3) ? 1E10 : 1E-10);
+
+    auto sum_with_threads = [&](size_t thread_count)
+    {
+        thread_pool pool(thread_count);
+        execution_scope _{ pool };
+
+        return parallel_transform_reduce(values.begin(), values.end(), 64, 0.0, std::plus{}, [](double f) { return f * f; });
+    };
+
+    const double sum = sum_with_threads(1);
+
+    REQUIRE(sum_with_threads(2) == sum);
+    REQUIRE(sum_with_threads(3) == sum);
+    REQUIRE(sum_with_threads(8) == sum);
+}
+
+TEST_CASE("parallel_for_exception", "[thread-pool]")
+{
+    const schedule_type schedule = GENERATE(schedule_type::static_blocks, schedule_type::dynamic, schedule_type::guided);
+
+    auto throw_on_last = [](int i) { if (i == 99) throw std::runtime_error("last"); };
+
+    REQUIRE_THROWS(parallel_for(iota_iterator(0), iota_iterator(100), schedule, throw_on_last));
+}
+
 TEST_CASE("nested_parallel_for", "[thread-pool]")
 {
     int n = 0;
@@ -70,3 +196,106 @@ TEST_CASE("nested_parallel_for", "[thread-pool]")
 
     REQUIRE(n == 10000);
 }
+
+TEST_CASE("execution_scope", "[thread-pool]")
+{
+    thread_pool pool(2);
+
+    std::mutex lock;
+    std::set<std::thread::id> thread_ids;
+
+    auto record_thread = [&](int)
+    {
+        std::scoped_lock _{ lock };
+        thread_ids.insert(std::this_thread::get_id());
+    };
+
+    {
+        execution_scope _{ pool };
+        REQUIRE(&execution_context::current() == &pool);
+
+        parallel_for(iota_iterator(0), iota_iterator(10), [&](int)
+        {
+            REQUIRE(&execution_context::current() == &pool);
+            parallel_for(iota_iterator(0), iota_iterator(100), record_thread);
+        });
+    }
+
+    REQUIRE(thread_ids.size() <= pool.thread_count());
+    REQUIRE(&execution_context::current() == &execution_context::global_thread_pool);
+}
+
+TEST_CASE("thread_pool_wait_policy", "[thread-pool]")
+{
+    const WaitPolicy policy = GENERATE(WaitPolicy{ 0, 0 }, WaitPolicy{ 0, 16 }, WaitPolicy{ 100000, 16 });
+
+    ThreadPool pool(4);
+    pool.wait_policy(policy);
+
+    REQUIRE(pool.wait_policy().spin_count == policy.spin_count);
+    REQUIRE(pool.wait_policy().yield_count == policy.yield_count);
+
+    int n = 0;
+    {
+        thread_pool local_pool(4);
+        local_pool.wait_policy(policy);
+        execution_scope _{ local_pool };
+
+        for (size_t i = 0; i < 100; i++)
+        {
+            parallel_for(iota_iterator(0), iota_iterator(10), [&](int) { std::atomic_ref{ n }.fetch_add(1, std::memory_order_relaxed); });
+        }
+    }
+
+    REQUIRE(n == 1000);
+}
+
+TEST_CASE("thread_pool_cpu_affinity", "[thread-pool]")
+{
+    const std::vector<size_t> cpus = numa_nodes().front().cpus;
+
+    thread_pool pool(4);
+    pool.cpu_affinity(cpus);
+    REQUIRE(pool.cpu_affinity() == cpus);
+
+    pool.thread_count(3);
+    REQUIRE(pool.cpu_affinity() == cpus);
+
+    int n = 0;
+    {
+        execution_scope _{ pool };
+        parallel_for(iota_iterator(0), iota_iterator(100), [&](int) { std::atomic_ref{ n }.fetch_add(1, std::memory_order_relaxed); });
+    }
+    REQUIRE(n == 100);
+
+    pool.cpu_affinity({});
+    REQUIRE(pool.cpu_affinity().empty());
+
+#if defined(__linux__) || defined(_WIN32)
+    REQUIRE_THROWS(pool.cpu_affinity({ size_t(-1) }));
+    REQUIRE(pool.cpu_affinity().empty());
+#endif
+}
+
+TEST_CASE("concurrent_ga_thread_pools", "[thread-pool]")
+{
+    problems::Sphere f{ 3 };
+
+    std::vector<RCGA> gas(4);
+    for (RCGA& ga : gas) ga.thread_pool(std::make_shared<ThreadPool>(2));
+
+    std::vector<Candidates<RealGene>> solutions(gas.size());
+    {
+        std::vector<std::jthread> threads;
+        for (size_t i = 0; i < gas.size(); i++)
+        {
+            threads.emplace_back([&, i] { solutions[i] = gas[i].solve(f, f.bounds(), 20); });
+        }
+    }
+
+    for (size_t i = 0; i < gas.size(); i++)
+    {
+        REQUIRE(gas[i].generation_cntr() == 19);
+        REQUIRE(!solutions[i].empty());
+    }
+}